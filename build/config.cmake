@@ -144,6 +144,10 @@ IF (ESCARGOT_THREADING)
     SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_THREADING -DGC_THREAD_ISOLATE)
 ENDIF()
 
+IF (ESCARGOT_GC_PARALLEL_MARK)
+    SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_GC_PARALLEL_MARK)
+ENDIF()
+
 IF (ESCARGOT_EXPORT_ALL)
     SET (ESCARGOT_CXXFLAGS ${ESCARGOT_CXXFLAGS} -fvisibility=default)
 ENDIF()
@@ -158,6 +162,10 @@ IF (ESCARGOT_TCO)
     ENDIF()
 ENDIF()
 
+IF (ESCARGOT_COMPACT_BYTECODE)
+    SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_COMPACT_BYTECODE)
+ENDIF()
+
 IF (ESCARGOT_TEMPORAL)
     SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_TEMPORAL)
 ENDIF()
@@ -95,6 +95,12 @@ ENDIF()
 IF (ESCARGOT_THREADING)
     SET (GCUTIL_ENABLE_THREADING ON)
 ENDIF()
+IF (ESCARGOT_GC_PARALLEL_MARK)
+    IF (NOT ESCARGOT_THREADING)
+        MESSAGE (FATAL_ERROR "ESCARGOT_GC_PARALLEL_MARK requires ESCARGOT_THREADING")
+    ENDIF()
+    SET (GCUTIL_CFLAGS ${GCUTIL_CFLAGS} -DPARALLEL_MARK)
+ENDIF()
 IF (ESCARGOT_TLS_ACCESS_BY_ADDRESS)
     SET (GCUTIL_ENABLE_TLS_ACCESS_BY_ADDRESS ON)
 ENDIF()
@@ -499,6 +499,12 @@ void customEscargotErrorLogger(const char* format, ...);
 #endif
 #endif
 
+// ByteCode holds the address of its interpreter label instead of opcode
+// ENABLE_COMPACT_BYTECODE stores 1-byte opcode and computed-goto interpreter looks up the address table on every fetch
+#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER) && !defined(ENABLE_COMPACT_BYTECODE)
+#define ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS
+#endif
+
 #define MAKE_STACK_ALLOCATED()                    \
     static void* operator new(size_t) = delete;   \
     static void* operator new[](size_t) = delete; \
@@ -566,6 +572,11 @@ typedef uint16_t LexicalBlockIndex;
 #define SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX 1024 * 256
 #endif
 
+// ages of ByteCodeBlock(in GC epoch) are grouped in log2 scale when selecting prune victims
+#ifndef SCRIPT_FUNCTION_OBJECT_BYTECODE_AGE_BUCKET_COUNT
+#define SCRIPT_FUNCTION_OBJECT_BYTECODE_AGE_BUCKET_COUNT 16
+#endif
+
 #ifndef REGEXP_CACHE_SIZE_MAX
 #define REGEXP_CACHE_SIZE_MAX 64
 #endif
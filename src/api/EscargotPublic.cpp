@@ -19,6 +19,7 @@
 
 #include "Escargot.h"
 #include "EscargotPublic.h"
+#include "heap/ArrayBufferAllocator.h"
 #include "parser/ast/Node.h"
 #include "parser/Script.h"
 #include "parser/ScriptParser.h"
@@ -569,6 +570,38 @@ void Memory::setGCFrequency(size_t value)
     GC_set_free_space_divisor(value);
 }
 
+void Memory::setGCMarkerThreadCount(size_t count)
+{
+    ASSERT(!Globals::isInitialized());
+    Heap::setMarkerThreadCount(count);
+}
+
+void Memory::setGCIncrementalPauseTarget(size_t milliseconds)
+{
+    ASSERT(!Globals::isInitialized());
+    Heap::setIncrementalPauseTarget(milliseconds);
+}
+
+void* Memory::allocateArrayBufferData(size_t sizeInByte)
+{
+    return ArrayBufferAllocator::allocate(sizeInByte);
+}
+
+void Memory::freeArrayBufferData(void* buffer, size_t sizeInByte)
+{
+    ArrayBufferAllocator::free(buffer, sizeInByte);
+}
+
+void* Memory::reallocateArrayBufferData(void* oldBuffer, size_t oldSizeInByte, size_t newSizeInByte)
+{
+    return ArrayBufferAllocator::reallocate(oldBuffer, oldSizeInByte, newSizeInByte);
+}
+
+void Memory::setArrayBufferDataHugePageEnabled(bool enabled)
+{
+    ArrayBufferAllocator::setHugePageEnabled(enabled);
+}
+
 size_t Memory::heapSize()
 {
     return GC_get_heap_size();
@@ -579,6 +612,37 @@ size_t Memory::totalSize()
     return GC_get_total_bytes();
 }
 
+Memory::GCStatistics Memory::gcStatistics()
+{
+    const Escargot::GCStatistics& stat = ThreadLocal::gcStatistics();
+    GCStatistics result;
+    result.gcCount = stat.gcCount();
+    result.lastMarkTime = stat.lastMarkTime();
+    result.lastSweepTime = stat.lastSweepTime();
+    result.lastPauseTime = stat.lastPauseTime();
+    result.totalPauseTime = stat.totalPauseTime();
+    result.maxPauseTime = stat.maxPauseTime();
+    result.pauseTimeP50 = stat.pauseTimePercentile(50);
+    result.pauseTimeP99 = stat.pauseTimePercentile(99);
+    result.lastAllocatedBytes = stat.lastAllocatedBytes();
+    result.lastHeapUsageBefore = stat.lastHeapUsageBefore();
+    result.lastHeapUsageAfter = stat.lastHeapUsageAfter();
+    result.lastReclaimedBytes = stat.lastReclaimedBytes();
+    result.totalReclaimedBytes = stat.totalReclaimedBytes();
+    return result;
+}
+
+Memory::ObjectStructureMemoryUsage Memory::objectStructureMemoryUsage()
+{
+    ObjectStructure::MemoryUsage usage = ObjectStructure::computeMemoryUsage();
+    ObjectStructureMemoryUsage result;
+    result.propertyTableCount = usage.propertyTableCount;
+    result.propertyTableBytes = usage.propertyTableBytes;
+    result.transitionTableCount = usage.transitionTableCount;
+    result.transitionTableBytes = usage.transitionTableBytes;
+    return result;
+}
+
 void Memory::addGCEventListener(GCEventType type, OnGCEventListener l, void* data)
 {
     GCEventListenerSet& list = ThreadLocal::gcEventListenerSet();
@@ -1377,6 +1441,25 @@ void VMInstanceRef::setOnVMInstanceDelete(OnVMInstanceDelete cb)
                                        (void*)cb);
 }
 
+void VMInstanceRef::setHeapLimit(size_t softLimit, size_t hardLimit, HeapLimitCallback callback)
+{
+    if (!callback) {
+        toImpl(this)->setHeapLimit(softLimit, hardLimit, nullptr, nullptr);
+        return;
+    }
+
+    toImpl(this)->setHeapLimit(softLimit, hardLimit, [](VMInstance* instance, size_t usage, void* callback) {
+        ASSERT(!!callback);
+        (reinterpret_cast<HeapLimitCallback>(callback))(toRef(instance), usage);
+    },
+                               (void*)callback);
+}
+
+size_t VMInstanceRef::heapUsage()
+{
+    return toImpl(this)->heapUsage();
+}
+
 #if defined(ENABLE_EXTENDED_API)
 void VMInstanceRef::registerErrorCreationCallback(ErrorCallback cb)
 {
@@ -1450,6 +1533,18 @@ void VMInstanceRef::enterIdleMode()
     toImpl(this)->enterIdleMode();
 }
 
+VMInstanceRef::IdleWorkResult VMInstanceRef::performIdleWork(uint64_t idleTimeInMicroseconds)
+{
+    VMInstance::IdleWorkResult r = toImpl(this)->performIdleWork(idleTimeInMicroseconds);
+    IdleWorkResult result;
+    result.gcPerformed = r.gcPerformed;
+    result.gcSliceCount = r.gcSliceCount;
+    result.compressedStringCount = r.compressedStringCount;
+    result.unloadedStringCount = r.unloadedStringCount;
+    result.hasRemainingWork = r.hasRemainingWork;
+    return result;
+}
+
 void VMInstanceRef::clearCachesRelatedWithContext()
 {
     toImpl(this)->clearCachesRelatedWithContext();
@@ -1499,6 +1594,33 @@ void VMInstanceRef::setMaxCompiledByteCodeSize(size_t s)
     toImpl(this)->setMaxCompiledByteCodeSize(s);
 }
 
+size_t VMInstanceRef::compiledByteCodeSize()
+{
+    size_t s = toImpl(this)->compiledByteCodeSize();
+    // max value means that pruning is in progress
+    return s == std::numeric_limits<size_t>::max() ? 0 : s;
+}
+
+size_t VMInstanceRef::prunedByteCodeSize()
+{
+    return toImpl(this)->prunedByteCodeSize();
+}
+
+size_t VMInstanceRef::byteCodeRegenerationCount()
+{
+    return toImpl(this)->byteCodeRegenerationCount();
+}
+
+uint64_t VMInstanceRef::byteCodeRegenerationTime()
+{
+    return toImpl(this)->byteCodeRegenerationTime();
+}
+
+bool VMInstanceRef::writeHeapSnapshot(const char* filePath)
+{
+    return Heap::writeHeapSnapshot(filePath);
+}
+
 #if defined(ENABLE_CODE_CACHE)
 bool VMInstanceRef::isCodeCacheEnabled()
 {
@@ -1534,6 +1656,26 @@ void VMInstanceRef::setCodeCacheShouldLoadFunctionOnScriptLoading(bool s)
 {
     toImpl(this)->codeCache()->setShouldLoadFunctionOnScriptLoading(s);
 }
+
+size_t VMInstanceRef::codeCacheHotFunctionExecutionCount()
+{
+    return toImpl(this)->codeCache()->hotFunctionExecutionCount();
+}
+
+void VMInstanceRef::setCodeCacheHotFunctionExecutionCount(size_t s)
+{
+    toImpl(this)->codeCache()->setHotFunctionExecutionCount(s);
+}
+
+size_t VMInstanceRef::codeCacheLoadCount()
+{
+    return toImpl(this)->codeCache()->loadCount();
+}
+
+uint64_t VMInstanceRef::codeCacheLoadTime()
+{
+    return toImpl(this)->codeCache()->loadTime();
+}
 #else // ENABLE_CODE_CACHE
 bool VMInstanceRef::isCodeCacheEnabled()
 {
@@ -1575,6 +1717,30 @@ void VMInstanceRef::setCodeCacheShouldLoadFunctionOnScriptLoading(bool s)
     ESCARGOT_LOG_ERROR("If you want to use this function, you should enable code cache");
     RELEASE_ASSERT_NOT_REACHED();
 }
+
+size_t VMInstanceRef::codeCacheHotFunctionExecutionCount()
+{
+    ESCARGOT_LOG_ERROR("If you want to use this function, you should enable code cache");
+    RELEASE_ASSERT_NOT_REACHED();
+}
+
+void VMInstanceRef::setCodeCacheHotFunctionExecutionCount(size_t s)
+{
+    ESCARGOT_LOG_ERROR("If you want to use this function, you should enable code cache");
+    RELEASE_ASSERT_NOT_REACHED();
+}
+
+size_t VMInstanceRef::codeCacheLoadCount()
+{
+    ESCARGOT_LOG_ERROR("If you want to use this function, you should enable code cache");
+    RELEASE_ASSERT_NOT_REACHED();
+}
+
+uint64_t VMInstanceRef::codeCacheLoadTime()
+{
+    ESCARGOT_LOG_ERROR("If you want to use this function, you should enable code cache");
+    RELEASE_ASSERT_NOT_REACHED();
+}
 #endif // ENABLE_CODE_CACHE
 
 #ifdef ESCARGOT_DEBUGGER
@@ -1922,7 +2088,7 @@ bool DebuggerOperationsRef::updateBreakpoint(WeakCodeRef* weakCodeRef, uint32_t
 
     ByteCode* breakpoint = (ByteCode*)(byteCode->m_code.data() + offset);
 
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS)
     if (enable) {
         if (breakpoint->m_opcodeInAddress != g_opcodeTable.m_addressTable[BreakpointDisabledOpcode]) {
             return false;
@@ -3263,6 +3429,11 @@ ContextRef* FunctionObjectRef::context()
     return toRef(toImpl(this)->codeBlock()->context());
 }
 
+bool FunctionObjectRef::isSimpleScriptFunction()
+{
+    return toImpl(this)->isScriptSimpleFunctionObject();
+}
+
 ValueRef* FunctionObjectRef::getFunctionPrototype(ExecutionStateRef* state)
 {
     FunctionObject* o = toImpl(this);
@@ -4960,6 +5131,31 @@ ScriptParserRef::InitializeScriptResult ScriptParserRef::initializeJSONModule(St
     return result;
 }
 
+uint64_t ScriptParserRef::programParseTime()
+{
+    return toImpl(this)->parseStatistics().m_programParseTime;
+}
+
+size_t ScriptParserRef::programParseCount()
+{
+    return toImpl(this)->parseStatistics().m_programParseCount;
+}
+
+uint64_t ScriptParserRef::functionParseTime()
+{
+    return toImpl(this)->parseStatistics().m_functionParseTime;
+}
+
+size_t ScriptParserRef::functionParseCount()
+{
+    return toImpl(this)->parseStatistics().m_functionParseCount;
+}
+
+size_t ScriptParserRef::astArenaPeakSize()
+{
+    return toImpl(this)->context()->astAllocator().takePeakPoolSize();
+}
+
 bool ScriptRef::isModule()
 {
     return toImpl(this)->isModule();
@@ -4990,6 +5186,11 @@ ValueRef* ScriptRef::execute(ExecutionStateRef* state)
     return toRef(toImpl(this)->execute(*toImpl(state)));
 }
 
+size_t ScriptRef::precompileFunctions(ExecutionStateRef* state, size_t maxByteCodeSize)
+{
+    return toImpl(this)->precompileFunctions(*toImpl(state), maxByteCodeSize);
+}
+
 size_t ScriptRef::moduleRequestsLength()
 {
     return toImpl(this)->moduleRequestsLength();
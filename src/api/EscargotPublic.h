@@ -189,6 +189,34 @@ public:
     static size_t heapSize(); // Return the number of bytes in the heap.  Excludes bdwgc private data structures. Excludes the unmapped memory
     static size_t totalSize(); // Return the total number of bytes allocated in this process
 
+    // gc telemetry of the current thread. every time value is in microseconds
+    struct GCStatistics {
+        size_t gcCount;
+        uint64_t lastMarkTime;
+        uint64_t lastSweepTime;
+        uint64_t lastPauseTime;
+        uint64_t totalPauseTime;
+        uint64_t maxPauseTime;
+        uint64_t pauseTimeP50; // percentiles are computed from the recent pause times
+        uint64_t pauseTimeP99;
+        size_t lastAllocatedBytes; // bytes allocated between the previous gc and the last gc
+        size_t lastHeapUsageBefore;
+        size_t lastHeapUsageAfter;
+        size_t lastReclaimedBytes;
+        size_t totalReclaimedBytes;
+    };
+    static GCStatistics gcStatistics();
+
+    // memory used by property tables and transition tables of object structures(hidden classes) in the current thread
+    // this runs gc to get precise result. so don't call this in performance-critical path
+    struct ObjectStructureMemoryUsage {
+        size_t propertyTableCount;
+        size_t propertyTableBytes;
+        size_t transitionTableCount;
+        size_t transitionTableBytes;
+    };
+    static ObjectStructureMemoryUsage objectStructureMemoryUsage();
+
     enum GCEventType {
         MARK_START,
         MARK_END,
@@ -204,6 +232,22 @@ public:
     // (Allocated memory by GC x 2) / (Frequency parameter value)
     // Increasing this value may use less space but there is more collection event
     static void setGCFrequency(size_t value = 1);
+
+    // collector configuration. these should be called before Globals::initialize (or Globals::initializeThread)
+    // marker thread count takes effect only if bdwgc is built with parallel mark (ESCARGOT_GC_PARALLEL_MARK)
+    static void setGCMarkerThreadCount(size_t count);
+    // enable incremental collection which tries to bound each gc pause to the given milliseconds
+    // 0 means stop-the-world collection (default)
+    static void setGCIncrementalPauseTarget(size_t milliseconds);
+
+    // default allocator of ArrayBuffer data used by PlatformRef
+    // small buffers are pooled per size class and large buffers are mapped directly (zero-filled lazily)
+    // returned memory is zero-filled. size of free and reallocate should be the same size used for allocation
+    static void* allocateArrayBufferData(size_t sizeInByte);
+    static void freeArrayBufferData(void* buffer, size_t sizeInByte);
+    static void* reallocateArrayBufferData(void* oldBuffer, size_t oldSizeInByte, size_t newSizeInByte);
+    // advise transparent huge pages for large ArrayBuffer data (only if OS supports)
+    static void setArrayBufferDataHugePageEnabled(bool enabled);
 };
 
 class ESCARGOT_EXPORT PersistentRefHolderBase {
@@ -691,6 +735,16 @@ public:
     typedef void (*OnVMInstanceDelete)(VMInstanceRef* instance);
     void setOnVMInstanceDelete(OnVMInstanceDelete cb);
 
+    // heap quota of this VMInstance (0 means no limit)
+    // usage counts gc heap of the current thread and ArrayBuffer data allocated on the current thread
+    // limits are checked when an ArrayBuffer is allocated or a script is executed,
+    // and on loop back-edges when the last gc found usage over the limit
+    // `callback` is called once per gc cycle when usage exceeds softLimit. you can call Memory::gc() inside of it
+    // exceeding hardLimit throws RangeError which can be caught by script or by Evaluator
+    typedef void (*HeapLimitCallback)(VMInstanceRef* instance, size_t usage);
+    void setHeapLimit(size_t softLimit, size_t hardLimit, HeapLimitCallback callback = nullptr);
+    size_t heapUsage();
+
     // register ErrorCallback which is triggered when each Error constructor (e.g. new TypeError()) invoked or thrown
     // parameter `err` stands for the newly created ErrorObject
     // these functions are used only for third party usage
@@ -741,6 +795,19 @@ public:
     // remove regexp cache,
     // and compress every comressible strings(if enabled) if we can
     void enterIdleMode();
+
+    struct IdleWorkResult {
+        bool gcPerformed; // full gc which also prunes bytecodes(if enabled)
+        size_t gcSliceCount; // steps of incremental gc (see Memory::setGCIncrementalPauseTarget)
+        size_t compressedStringCount;
+        size_t unloadedStringCount;
+        bool hasRemainingWork; // time was over before finishing every work
+    };
+    // do the work of enterIdleMode within the given idle time
+    // work which is expected to release more memory runs first and remaining work continues on the next call
+    // so you can call this function in short idle slots of your event loop
+    IdleWorkResult performIdleWork(uint64_t idleTimeInMicroseconds);
+
     // force clear every caches related with context
     // you can call this function if you don't want to use every alive contexts
     void clearCachesRelatedWithContext();
@@ -768,6 +835,17 @@ public:
 
     size_t maxCompiledByteCodeSize();
     void setMaxCompiledByteCodeSize(size_t s);
+    // statistics of compiled bytecode pruning
+    // these values can be used for tuning maxCompiledByteCodeSize
+    size_t compiledByteCodeSize();
+    size_t prunedByteCodeSize(); // total size of pruned bytecode
+    size_t byteCodeRegenerationCount(); // count of regenerating pruned bytecode
+    uint64_t byteCodeRegenerationTime(); // total time of regeneration in microseconds
+
+    // write a snapshot of the whole gc heap in .heapsnapshot format (loadable by Chrome DevTools)
+    // objects are named after their gc kind and references are found by scanning every word of objects,
+    // so a non-pointer value which looks like a pointer can appear as a reference
+    bool writeHeapSnapshot(const char* filePath);
 
     bool isCodeCacheEnabled();
     size_t codeCacheMinSourceLength();
@@ -776,6 +854,12 @@ public:
     void setCodeCacheMaxCacheCount(size_t s);
     bool codeCacheShouldLoadFunctionOnScriptLoading();
     void setCodeCacheShouldLoadFunctionOnScriptLoading(bool s);
+    // functions called more than this count in previous runs are loaded with global code
+    // 0 disables it (default)
+    size_t codeCacheHotFunctionExecutionCount();
+    void setCodeCacheHotFunctionExecutionCount(size_t s);
+    size_t codeCacheLoadCount(); // count of loading global or function code from cache
+    uint64_t codeCacheLoadTime(); // total time of loading from cache in microseconds
 };
 
 class ESCARGOT_EXPORT DebuggerOperationsRef {
@@ -1632,6 +1716,10 @@ public:
     // returns associate context
     ContextRef* context();
 
+    // returns true if this script function is called through the simple function call path
+    // the path is selected once when bytecode of the function is generated or when the function object is created with bytecode ready
+    bool isSimpleScriptFunction();
+
     // get prototype property of constructible function(not [[prototype]])
     // this property is used for new object construction. see https://www.ecma-international.org/ecma-262/6.0/#sec-ordinarycreatefromconstructor
     ValueRef* getFunctionPrototype(ExecutionStateRef* state);
@@ -2179,6 +2267,15 @@ public:
     InitializeFunctionScriptResult initializeFunctionScript(StringRef* sourceName, AtomicStringRef* functionName, size_t argumentCount, ValueRef** argumentNameArray, ValueRef* functionBody);
     // parse the input JSON data and return the result (Script)
     InitializeScriptResult initializeJSONModule(StringRef* sourceCode, StringRef* srcName);
+
+    // accumulated parsing time (in microseconds) and count of
+    // the first pass over whole scripts and the lazy parsing of each function
+    uint64_t programParseTime();
+    size_t programParseCount();
+    uint64_t functionParseTime();
+    size_t functionParseCount();
+    // largest memory (in bytes) used by the AST arena for a single parsing since the last call of this function
+    size_t astArenaPeakSize();
 };
 
 class ESCARGOT_EXPORT ScriptRef {
@@ -2189,6 +2286,10 @@ public:
     StringRef* sourceCode();
     ContextRef* context();
     ValueRef* execute(ExecutionStateRef* state);
+    // compile functions of this script before their first call to reduce cold-start latency
+    // compiling stops when the size of generated bytecode reaches maxByteCodeSize or VMInstanceRef::maxCompiledByteCodeSize
+    // returns the number of compiled functions. an error while generating bytecode is thrown to the caller
+    size_t precompileFunctions(ExecutionStateRef* state, size_t maxByteCodeSize = std::numeric_limits<size_t>::max());
 
     // only module can use these functions
     size_t moduleRequestsLength();
@@ -2215,23 +2316,20 @@ public:
 
     // ArrayBuffer
     // client must returns zero-filled memory
+    // default implementation uses Memory::allocateArrayBufferData family
+    // if you override one of these functions, you should override all of them
     virtual void* onMallocArrayBufferObjectDataBuffer(size_t sizeInByte)
     {
-        return calloc(sizeInByte, 1);
+        return Memory::allocateArrayBufferData(sizeInByte);
     }
     virtual void onFreeArrayBufferObjectDataBuffer(void* buffer, size_t sizeInByte)
     {
-        return free(buffer);
+        Memory::freeArrayBufferData(buffer, sizeInByte);
     }
 
     virtual void* onReallocArrayBufferObjectDataBuffer(void* oldBuffer, size_t oldSizeInByte, size_t newSizeInByte)
     {
-        void* ptr = realloc(oldBuffer, newSizeInByte);
-        if (oldSizeInByte < newSizeInByte) {
-            uint8_t* s = static_cast<uint8_t*>(ptr);
-            memset(s + oldSizeInByte, 0, newSizeInByte - oldSizeInByte);
-        }
-        return ptr;
+        return Memory::reallocateArrayBufferData(oldBuffer, oldSizeInByte, newSizeInByte);
     }
 
     // If you want to add a Job event, you should call VMInstanceRef::executePendingJob after event. see Shell.cpp
@@ -1658,86 +1658,61 @@ void GlobalObject::installString(ExecutionState& state)
                                                ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->toString, builtinStringToString, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     // $21.1.3.4 String.prototype.concat
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->concat),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->concat, builtinStringConcat, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, concat, builtinStringConcat, 1);
 
     // $21.1.3.8 String.prototype.indexOf
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->indexOf),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->indexOf, builtinStringIndexOf, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, indexOf, builtinStringIndexOf, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->lastIndexOf),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->lastIndexOf, builtinStringLastIndexOf, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, lastIndexOf, builtinStringLastIndexOf, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->localeCompare),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->localeCompare, builtinStringLocaleCompare, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, localeCompare, builtinStringLocaleCompare, 1);
 
     // $21.1.3.16 String.prototype.slice
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->slice),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->slice, builtinStringSlice, 2, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, slice, builtinStringSlice, 2);
 
     // $21.1.3.19 String.prototype.substring
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->substring),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->substring, builtinStringSubstring, 2, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, substring, builtinStringSubstring, 2);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->substr),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->substr, builtinStringSubstr, 2, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, substr, builtinStringSubstr, 2);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->match),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->match, builtinStringMatch, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, match, builtinStringMatch, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->matchAll),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->matchAll, builtinStringMatchAll, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, matchAll, builtinStringMatchAll, 1);
 
 #if defined(ENABLE_ICU)
     // The length property of the normalize method is 0.
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->normalize),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->normalize, builtinStringNormalize, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, normalize, builtinStringNormalize, 0);
 #endif // ENABLE_ICU
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->repeat),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->repeat, builtinStringRepeat, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, repeat, builtinStringRepeat, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->replace),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->replace, builtinStringReplace, 2, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, replace, builtinStringReplace, 2);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->replaceAll),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->replaceAll, builtinStringReplaceAll, 2, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, replaceAll, builtinStringReplaceAll, 2);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->search),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->search, builtinStringSearch, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, search, builtinStringSearch, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->split),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->split, builtinStringSplit, 2, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, split, builtinStringSplit, 2);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->charCodeAt),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->charCodeAt, builtinStringCharCodeAt, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, charCodeAt, builtinStringCharCodeAt, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->codePointAt),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->codePointAt, builtinStringCodePointAt, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, codePointAt, builtinStringCodePointAt, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->charAt),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->charAt, builtinStringCharAt, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, charAt, builtinStringCharAt, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->toLowerCase),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->toLowerCase, builtinStringToLowerCase, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, toLowerCase, builtinStringToLowerCase, 0);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->toUpperCase),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->toUpperCase, builtinStringToUpperCase, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, toUpperCase, builtinStringToUpperCase, 0);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->toLocaleLowerCase),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->toLocaleLowerCase, builtinStringToLocaleLowerCase, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, toLocaleLowerCase, builtinStringToLocaleLowerCase, 0);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->toLocaleUpperCase),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->toLocaleUpperCase, builtinStringToLocaleUpperCase, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, toLocaleUpperCase, builtinStringToLocaleUpperCase, 0);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->trim),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->trim, builtinStringTrim, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, trim, builtinStringTrim, 0);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->padStart),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->padStart, builtinStringPadStart, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, padStart, builtinStringPadStart, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->padEnd),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->padEnd, builtinStringPadEnd, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, padEnd, builtinStringPadEnd, 1);
 
     FunctionObject* trimStart = new NativeFunctionObject(state, NativeFunctionInfo(strings->trimStart, builtinStringTrimStart, 0, NativeFunctionInfo::Strict));
     FunctionObject* trimEnd = new NativeFunctionObject(state, NativeFunctionInfo(strings->trimEnd, builtinStringTrimEnd, 0, NativeFunctionInfo::Strict));
@@ -1760,38 +1735,24 @@ void GlobalObject::installString(ExecutionState& state)
                                                                         (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     // ES6 builtins
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->startsWith),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->startsWith, builtinStringStartsWith, 1, NativeFunctionInfo::Strict)),
-                                                                        (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, startsWith, builtinStringStartsWith, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->endsWith),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->endsWith, builtinStringEndsWith, 1, NativeFunctionInfo::Strict)),
-                                                                        (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, endsWith, builtinStringEndsWith, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->includes),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->includes, builtinStringIncludes, 1, NativeFunctionInfo::Strict)),
-                                                                        (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, includes, builtinStringIncludes, 1);
 
     m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->vmInstance()->globalSymbols().iterator),
                                                ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(AtomicString(state, String::fromASCII("[Symbol.iterator]")), builtinStringIterator, 0, NativeFunctionInfo::Strict)),
                                                                         (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->at),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->at, builtinStringAt, 1, NativeFunctionInfo::Strict)),
-                                                                        (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, at, builtinStringAt, 1);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->isWellFormed),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->isWellFormed, builtinStringIsWellFormed, 0, NativeFunctionInfo::Strict)),
-                                                                        (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, isWellFormed, builtinStringIsWellFormed, 0);
 
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->toWellFormed),
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->toWellFormed, builtinStringToWellFormed, 0, NativeFunctionInfo::Strict)),
-                                                                        (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, toWellFormed, builtinStringToWellFormed, 0);
 
-#define DEFINE_STRING_ADDITIONAL_HTML_FUNCTION(fnName, argLength)                                                                                                                                           \
-    m_stringPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->fnName),                                                                                                                  \
-                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->fnName, builtinString##fnName, argLength, NativeFunctionInfo::Strict)), \
-                                                                        (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+#define DEFINE_STRING_ADDITIONAL_HTML_FUNCTION(fnName, argLength) \
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_stringPrototype, fnName, builtinString##fnName, argLength);
 
     // String.prototype.anchor (name)
     DEFINE_STRING_ADDITIONAL_HTML_FUNCTION(anchor, 1)
@@ -1822,14 +1783,11 @@ void GlobalObject::installString(ExecutionState& state)
 
 #undef DEFINE_STRING_ADDITIONAL_HTML_FUNCTION
 
-    m_string->directDefineOwnProperty(state, ObjectPropertyName(strings->fromCharCode),
-                                      ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->fromCharCode, builtinStringFromCharCode, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_string, fromCharCode, builtinStringFromCharCode, 1);
 
-    m_string->directDefineOwnProperty(state, ObjectPropertyName(strings->fromCodePoint),
-                                      ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->fromCodePoint, builtinStringFromCodePoint, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_string, fromCodePoint, builtinStringFromCodePoint, 1);
 
-    m_string->directDefineOwnProperty(state, ObjectPropertyName(strings->raw),
-                                      ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->raw, builtinStringRaw, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    DEFINE_LAZY_BUILTIN_METHOD(state, m_string, raw, builtinStringRaw, 1);
 
     m_string->setFunctionPrototype(state, m_stringPrototype);
 
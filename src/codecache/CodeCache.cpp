@@ -34,13 +34,119 @@
 #include <dirent.h>
 #include <sys/stat.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #define CODE_CACHE_FILE_DIR "/Escargot-cache/"
 #define CODE_CACHE_LIST_FILE_NAME "cache_list"
+// should be increased when the layout of cache list is changed
+#define CODE_CACHE_LIST_FORMAT_VERSION "2"
 
 namespace Escargot {
 
+static inline uint64_t sourceHashRotateLeft(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t sourceHashRound(uint64_t acc, uint64_t input)
+{
+    acc += input * 0xC2B2AE3D27D4EB4FULL;
+    acc = sourceHashRotateLeft(acc, 31);
+    return acc * 0x9E3779B185EBCA87ULL;
+}
+
+template <typename CharType>
+static inline uint64_t sourceHashLoad(const CharType* p)
+{
+    // narrow Latin-1 characters of 16-bit source into the same bytes as 8-bit source
+    uint8_t bytes[8];
+    for (size_t i = 0; i < 8; i++) {
+        bytes[i] = static_cast<uint8_t>(p[i]);
+    }
+    uint64_t w;
+    memcpy(&w, bytes, sizeof(w));
+    return w;
+}
+
+template <>
+inline uint64_t sourceHashLoad<uint8_t>(const uint8_t* p)
+{
+    uint64_t w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+// hash units of source with 4 independent lanes, 8 units at once
+template <typename CharType>
+static uint64_t sourceHash(const CharType* p, size_t length, bool isWide)
+{
+    const uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    const uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    const uint64_t prime3 = 0x165667B19E3779F9ULL;
+
+    const CharType* end = p + length;
+
+    uint64_t lane0 = prime1 + prime2;
+    uint64_t lane1 = prime2;
+    uint64_t lane2 = 0;
+    uint64_t lane3 = 0 - prime1;
+    while (end - p >= 32) {
+        lane0 = sourceHashRound(lane0, sourceHashLoad(p));
+        lane1 = sourceHashRound(lane1, sourceHashLoad(p + 8));
+        lane2 = sourceHashRound(lane2, sourceHashLoad(p + 16));
+        lane3 = sourceHashRound(lane3, sourceHashLoad(p + 24));
+        p += 32;
+    }
+
+    uint64_t hash = sourceHashRotateLeft(lane0, 1) + sourceHashRotateLeft(lane1, 7) + sourceHashRotateLeft(lane2, 12) + sourceHashRotateLeft(lane3, 18);
+    hash ^= length;
+    hash ^= isWide ? prime3 : 0;
+
+    while (end - p >= 8) {
+        hash = sourceHashRotateLeft(hash ^ sourceHashRound(0, sourceHashLoad(p)), 27) * prime1;
+        p += 8;
+    }
+    while (p < end) {
+        hash = sourceHashRotateLeft(hash ^ (static_cast<uint8_t>(*p) * prime3), 11) * prime1;
+        p++;
+    }
+
+    // final mix
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// source code of bundles could be several MB
+// so read 8 bytes at once with 4 independent lanes instead of per-character fnv hash
+// the hash is computed over Latin-1 bytes whenever source can be represented in Latin-1
+// so 8-bit and 16-bit String of the same source share the same cache
+size_t CodeCache::computeSourceHash(String* source)
+{
+    const auto& data = source->bufferAccessData();
+    if (data.has8BitContent) {
+        return static_cast<size_t>(sourceHash(reinterpret_cast<const uint8_t*>(data.buffer), data.length, false));
+    }
+
+    const char16_t* chars = reinterpret_cast<const char16_t*>(data.buffer);
+    bool isLatin1 = true;
+    for (size_t i = 0; i < data.length; i++) {
+        if (chars[i] > 0xFF) {
+            isLatin1 = false;
+            break;
+        }
+    }
+
+    if (isLatin1) {
+        return static_cast<size_t>(sourceHash(chars, data.length, false));
+    }
+    return static_cast<size_t>(sourceHash(reinterpret_cast<const uint8_t*>(chars), data.length * sizeof(char16_t), true));
+}
+
 static std::string createCacheFilePath(const std::string& cacheDirPath, const CodeCacheIndex& cacheIndex)
 {
     std::stringstream ss;
@@ -54,6 +160,10 @@ void CodeCache::CodeCacheContext::reset()
     m_cacheFilePath.clear();
     m_cacheEntry.reset();
 
+    // mapping is owned by CodeCache
+    m_mappedCacheFile = nullptr;
+    m_mappedCacheFileSize = 0;
+
     if (m_cacheFile) {
         fclose(m_cacheFile);
         m_cacheFile = nullptr;
@@ -75,6 +185,9 @@ CodeCache::CodeCache(const char* baseCacheDir)
     , m_status(Status::NONE)
     , m_minSourceLength(CODE_CACHE_MIN_SOURCE_LENGTH)
     , m_maxCacheCount(CODE_CACHE_MAX_CACHE_COUNT)
+    , m_hotFunctionExecutionCount(CODE_CACHE_HOT_FUNCTION_EXECUTION_COUNT)
+    , m_loadCount(0)
+    , m_loadTime(0)
 {
     initialize(baseCacheDir);
 }
@@ -189,7 +302,7 @@ bool CodeCache::tryInitCacheList()
         fclose(listFile);
         return false;
     }
-    std::string currentVer = ESCARGOT_VERSION;
+    std::string currentVer = ESCARGOT_VERSION CODE_CACHE_LIST_FORMAT_VERSION;
     ASSERT(currentVer.length() > 0);
     size_t currentVerHash = std::hash<std::string>{}(currentVer);
     if (UNLIKELY(currentVerHash != cacheVerHash)) {
@@ -279,6 +392,7 @@ void CodeCache::clearCacheDir()
 void CodeCache::clear()
 {
     m_currentContext.reset();
+    unmapAllCacheFiles();
 
     unLockAndCloseCacheDir();
 
@@ -392,6 +506,8 @@ bool CodeCache::removeCacheFile(const CodeCacheIndex::ScriptID& scriptID)
     ASSERT(m_cacheDirPath.length());
     ASSERT(scriptID.m_srcHash && scriptID.m_srcLength);
 
+    unmapCacheFile(scriptID);
+
     std::string filePath = createCacheFilePath(m_cacheDirPath, CodeCacheIndex(scriptID.m_srcHash, scriptID.m_srcLength, 0));
     if (remove(filePath.data()) != 0) {
         ESCARGOT_LOG_ERROR("[CodeCache] can`t remove a cache file %s\n", filePath.data());
@@ -404,6 +520,25 @@ bool CodeCache::removeCacheFile(const CodeCacheIndex::ScriptID& scriptID)
     return true;
 }
 
+void CodeCache::unmapCacheFile(const CodeCacheIndex::ScriptID& scriptID)
+{
+    auto iter = m_mappedCacheFiles.find(scriptID);
+    if (iter != m_mappedCacheFiles.end()) {
+        ASSERT(m_currentContext.m_mappedCacheFile != iter->second.m_data);
+        munmap(iter->second.m_data, iter->second.m_size);
+        m_mappedCacheFiles.erase(iter);
+    }
+}
+
+void CodeCache::unmapAllCacheFiles()
+{
+    ASSERT(!m_currentContext.m_mappedCacheFile);
+    for (auto iter = m_mappedCacheFiles.begin(); iter != m_mappedCacheFiles.end(); iter++) {
+        munmap(iter->second.m_data, iter->second.m_size);
+    }
+    m_mappedCacheFiles.clear();
+}
+
 std::pair<bool, CodeCacheEntry> CodeCache::searchCache(const CodeCacheIndex& cacheIndex)
 {
     ASSERT(m_enabled && cacheIndex.isValid());
@@ -424,13 +559,18 @@ bool CodeCache::loadGlobalCache(Context* context, const CodeCacheIndex& cacheInd
 {
     ASSERT(m_enabled && cacheIndex.isValid());
 
+    uint64_t startTime = longTickCount();
+
     // load global CodeBlock and its related information
     prepareCacheLoading(context, cacheIndex, entry);
 
     InterpretedCodeBlock* topCodeBlock = loadCodeBlockTree(context, script);
     ByteCodeBlock* topByteCodeBlock = loadByteCodeBlock(context, topCodeBlock);
 
-    if (!postCacheLoading()) {
+    bool result = postCacheLoading();
+    m_loadCount++;
+    m_loadTime += longTickCount() - startTime;
+    if (!result) {
         return false;
     }
 
@@ -447,12 +587,16 @@ bool CodeCache::loadFunctionCache(Context* context, const CodeCacheIndex& cacheI
 {
     ASSERT(m_enabled && cacheIndex.isValid());
 
+    uint64_t startTime = longTickCount();
+
     // load function CodeBlock and its related information
     prepareCacheLoading(context, cacheIndex, entry);
 
     codeBlock->m_byteCodeBlock = loadByteCodeBlock(context, codeBlock);
 
     bool result = postCacheLoading();
+    m_loadCount++;
+    m_loadTime += longTickCount() - startTime;
     if (result) {
         ESCARGOT_LOG_INFO("[CodeCache] Load CodeCache Done (%s: index %zu size %zu)\n", codeBlock->script()->srcName()->toNonGCUTF8StringData().data(),
                           codeBlock->functionStart().index, codeBlock->src().length());
@@ -517,6 +661,41 @@ bool CodeCache::storeFunctionCache(Context* context, const CodeCacheIndex& cache
     return result;
 }
 
+void CodeCache::storeProfileData(VMInstance* instance)
+{
+    if (!m_enabled || m_status != Status::READY) {
+        return;
+    }
+
+    bool updated = false;
+    auto& v = instance->compiledByteCodeBlocks();
+    for (size_t i = 0; i < v.size(); i++) {
+        ByteCodeBlock* block = v[i];
+        InterpretedCodeBlock* codeBlock = block->m_codeBlock;
+        // same condition with function cache storing
+        if (!codeBlock->parent() || codeBlock->src().length() <= m_minSourceLength) {
+            continue;
+        }
+
+        Script* script = codeBlock->script();
+        auto iter = m_cacheList.find(CodeCacheIndex(script->sourceCodeHashValue(), script->sourceCode()->length(), codeBlock->functionStart().index));
+        if (iter == m_cacheList.end()) {
+            continue;
+        }
+
+        size_t count = block->m_totalExecutionCount + block->m_executionCount;
+        if (count > iter->second.m_executionCount) {
+            iter->second.m_executionCount = count;
+            updated = true;
+        }
+    }
+
+    if (updated && UNLIKELY(!writeCacheList())) {
+        m_status = Status::FAILED;
+        clearAll();
+    }
+}
+
 void CodeCache::prepareCacheLoading(Context* context, const CodeCacheIndex& cacheIndex, const CodeCacheEntry& entry)
 {
     ASSERT(m_enabled && m_status == Status::READY);
@@ -529,13 +708,43 @@ void CodeCache::prepareCacheLoading(Context* context, const CodeCacheIndex& cach
 
     m_currentContext.m_cacheFilePath = createCacheFilePath(m_cacheDirPath, cacheIndex);
     m_currentContext.m_cacheEntry = entry;
-    FILE* dataFile = fopen(m_currentContext.m_cacheFilePath.data(), "rb");
-    if (UNLIKELY(!dataFile)) {
-        ESCARGOT_LOG_ERROR("[CodeCache] can't open the cache data file %s\n", m_currentContext.m_cacheFilePath.data());
-        m_status = Status::FAILED;
-        return;
+
+    auto mappedFile = m_mappedCacheFiles.find(cacheIndex.scriptID());
+    if (mappedFile == m_mappedCacheFiles.end()) {
+        FILE* dataFile = fopen(m_currentContext.m_cacheFilePath.data(), "rb");
+        if (UNLIKELY(!dataFile)) {
+            ESCARGOT_LOG_ERROR("[CodeCache] can't open the cache data file %s\n", m_currentContext.m_cacheFilePath.data());
+            m_status = Status::FAILED;
+            return;
+        }
+
+        // map the whole data file so that cache data is read in place without copying
+        // the mapping is reused by the following loadings of the same script (e.g. lazy function loading)
+        // if mapping fails, fall back to reading data with fread
+        struct stat st;
+        if (LIKELY(fstat(fileno(dataFile), &st) == 0 && st.st_size > 0)) {
+            void* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fileno(dataFile), 0);
+            if (LIKELY(mapped != MAP_FAILED)) {
+                CodeCacheMappedFile file;
+                file.m_data = static_cast<char*>(mapped);
+                file.m_size = st.st_size;
+                mappedFile = m_mappedCacheFiles.insert(std::make_pair(cacheIndex.scriptID(), file)).first;
+            }
+        }
+
+        if (UNLIKELY(mappedFile == m_mappedCacheFiles.end())) {
+            m_currentContext.m_cacheFile = dataFile;
+        } else {
+            // mapping remains valid after closing the file
+            fclose(dataFile);
+        }
     }
-    m_currentContext.m_cacheFile = dataFile;
+
+    if (LIKELY(mappedFile != m_mappedCacheFiles.end())) {
+        m_currentContext.m_mappedCacheFile = mappedFile->second.m_data;
+        m_currentContext.m_mappedCacheFileSize = mappedFile->second.m_size;
+    }
+
     m_currentContext.m_cacheStringTable = loadCacheStringTable(context);
 }
 
@@ -548,6 +757,9 @@ void CodeCache::prepareCacheWriting(const CodeCacheIndex& cacheIndex)
 
     m_status = Status::IN_PROGRESS;
 
+    // data is appended to the file. map it again on the next loading
+    unmapCacheFile(cacheIndex.scriptID());
+
     m_currentContext.m_cacheFilePath = createCacheFilePath(m_cacheDirPath, cacheIndex);
     m_currentContext.m_cacheStringTable = new CacheStringTable();
     FILE* dataFile = fopen(m_currentContext.m_cacheFilePath.data(), "ab");
@@ -761,8 +973,11 @@ InterpretedCodeBlock* CodeCache::loadCodeBlockTree(Context* context, Script* scr
     }
 
     // load bytecode of functions
+    // if not all of them, load only functions which were hot in previous runs
     if (m_shouldLoadFunctionOnScriptLoading) {
-        loadAllByteCodeBlockOfFunctions(context, tempCodeBlockVector, script);
+        loadAllByteCodeBlockOfFunctions(context, tempCodeBlockVector, script, 0);
+    } else if (m_hotFunctionExecutionCount) {
+        loadAllByteCodeBlockOfFunctions(context, tempCodeBlockVector, script, m_hotFunctionExecutionCount);
     }
 
     // clear
@@ -805,11 +1020,11 @@ ByteCodeBlock* CodeCache::loadByteCodeBlock(Context* context, InterpretedCodeBlo
     return block;
 }
 
-void CodeCache::loadAllByteCodeBlockOfFunctions(Context* context, std::vector<InterpretedCodeBlock*>& codeBlockVector, Script* script)
+void CodeCache::loadAllByteCodeBlockOfFunctions(Context* context, std::vector<InterpretedCodeBlock*>& codeBlockVector, Script* script, size_t minExecutionCount)
 {
     // load CodeBlock of functions during loading of global code
     ASSERT(m_enabled && m_status == Status::IN_PROGRESS);
-    ASSERT(m_currentContext.m_cacheFilePath.length() && m_currentContext.m_cacheFile);
+    ASSERT(m_currentContext.m_cacheFilePath.length() && (m_currentContext.m_cacheFile || m_currentContext.m_mappedCacheFile));
 
     size_t srcHash = script->sourceCodeHashValue();
     size_t srcLength = script->sourceCode()->length();
@@ -822,7 +1037,7 @@ void CodeCache::loadAllByteCodeBlockOfFunctions(Context* context, std::vector<In
         InterpretedCodeBlock* codeBlock = codeBlockVector[i];
         ASSERT(script == codeBlock->script());
         auto result = searchCache(CodeCacheIndex(srcHash, srcLength, codeBlock->functionStart().index));
-        if (result.first) {
+        if (result.first && result.second.m_executionCount >= minExecutionCount) {
             CodeCacheEntry& cacheEntry = result.second;
 
             // init context
@@ -875,7 +1090,7 @@ bool CodeCache::writeCacheList()
     }
 
     // first write Escargot version
-    std::string version = ESCARGOT_VERSION;
+    std::string version = ESCARGOT_VERSION CODE_CACHE_LIST_FORMAT_VERSION;
     ASSERT(version.length() > 0);
     size_t versionHash = std::hash<std::string>{}(version);
     if (UNLIKELY(fwrite(&versionHash, sizeof(size_t), 1, listFile) != 1)) {
@@ -965,9 +1180,19 @@ bool CodeCache::readCacheData(CodeCacheMetaInfo& metaInfo)
     ASSERT(m_enabled);
     ASSERT(metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK || metaInfo.cacheType == CodeCacheType::CACHE_BYTECODE || metaInfo.cacheType == CodeCacheType::CACHE_STRING);
     ASSERT(!!m_currentContext.m_cacheFilePath.length());
-    ASSERT(!!m_currentContext.m_cacheFile);
+    ASSERT(!!m_currentContext.m_cacheFile || !!m_currentContext.m_mappedCacheFile);
 
     size_t dataOffset = metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK ? 0 : metaInfo.dataOffset;
+
+    if (LIKELY(!!m_currentContext.m_mappedCacheFile)) {
+        if (UNLIKELY(dataOffset > m_currentContext.m_mappedCacheFileSize || metaInfo.dataSize > m_currentContext.m_mappedCacheFileSize - dataOffset)) {
+            ESCARGOT_LOG_ERROR("[CodeCache] invalid cache data offset of %s\n", m_currentContext.m_cacheFilePath.data());
+            return false;
+        }
+        m_cacheReader->loadMappedData(m_currentContext.m_mappedCacheFile + dataOffset, metaInfo.dataSize);
+        return true;
+    }
+
     FILE* dataFile = m_currentContext.m_cacheFile;
 
     if (UNLIKELY(fseek(dataFile, dataOffset, SEEK_SET) != 0)) {
@@ -1012,5 +1237,15 @@ void CodeCache::setShouldLoadFunctionOnScriptLoading(bool s)
 {
     m_shouldLoadFunctionOnScriptLoading = s;
 }
+
+size_t CodeCache::hotFunctionExecutionCount()
+{
+    return m_hotFunctionExecutionCount;
+}
+
+void CodeCache::setHotFunctionExecutionCount(size_t s)
+{
+    m_hotFunctionExecutionCount = s;
+}
 } // namespace Escargot
 #endif // ENABLE_CODE_CACHE
@@ -38,10 +38,18 @@
 #define CODE_CACHE_SHOULD_LOAD_FUNCTIONS_ON_SCRIPT_LOADING false
 #endif
 
+// functions called more than this count in previous runs are loaded with global code
+// 0 disables it. loading bytecode of functions eagerly changes startup behavior, so it is opt-in
+#ifndef CODE_CACHE_HOT_FUNCTION_EXECUTION_COUNT
+#define CODE_CACHE_HOT_FUNCTION_EXECUTION_COUNT 0
+#endif
+
 namespace Escargot {
 
 class Script;
 class Context;
+class String;
+class VMInstance;
 class CodeCacheWriter;
 class CodeCacheReader;
 class CacheStringTable;
@@ -198,6 +206,7 @@ namespace Escargot {
 
 struct CodeCacheEntry {
     CodeCacheEntry()
+        : m_executionCount(0)
     {
     }
 
@@ -208,6 +217,7 @@ struct CodeCacheEntry {
         }
     }
     CodeCacheMetaInfo m_metaInfos[(size_t)CodeCacheType::CACHE_TYPE_NUM];
+    size_t m_executionCount; // profile data of function (number of calls in previous runs)
 };
 
 class CodeCache {
@@ -225,6 +235,8 @@ public:
     struct CodeCacheContext {
         CodeCacheContext()
             : m_cacheFile(nullptr)
+            , m_mappedCacheFile(nullptr)
+            , m_mappedCacheFileSize(0)
             , m_cacheStringTable(nullptr)
             , m_cacheDataOffset(0)
         {
@@ -235,6 +247,8 @@ public:
         std::string m_cacheFilePath; // current cache data file path
         CodeCacheEntry m_cacheEntry; // current cache entry
         FILE* m_cacheFile; // current cache data file
+        char* m_mappedCacheFile; // read-only mapping of current cache data file (only for loading, owned by CodeCache::m_mappedCacheFiles)
+        size_t m_mappedCacheFileSize;
         CacheStringTable* m_cacheStringTable; // current CacheStringTable
         size_t m_cacheDataOffset; // current offset in cache data file
     };
@@ -257,6 +271,9 @@ public:
     CodeCache(const char* baseCacheDir);
     ~CodeCache();
 
+    // hash value of entire source code used for cache index
+    static size_t computeSourceHash(String* source);
+
     bool enabled() const { return m_enabled; }
     std::pair<bool, CodeCacheEntry> searchCache(const CodeCacheIndex& cacheIndex);
 
@@ -264,6 +281,8 @@ public:
     bool loadFunctionCache(Context* context, const CodeCacheIndex& cacheIndex, const CodeCacheEntry& entry, InterpretedCodeBlock* codeBlock);
     bool storeGlobalCache(Context* context, const CodeCacheIndex& cacheIndex, InterpretedCodeBlock* topCodeBlock, CodeBlockCacheInfo* codeBlockCacheInfo, Node* programNode, bool inWith);
     bool storeFunctionCache(Context* context, const CodeCacheIndex& cacheIndex, InterpretedCodeBlock* codeBlock, Node* functionNode);
+    // record execution count of each cached function
+    void storeProfileData(VMInstance* instance);
 
     void clear();
 
@@ -273,8 +292,19 @@ public:
     void setMaxCacheCount(size_t s);
     bool shouldLoadFunctionOnScriptLoading();
     void setShouldLoadFunctionOnScriptLoading(bool s);
+    size_t hotFunctionExecutionCount();
+    void setHotFunctionExecutionCount(size_t s);
+
+    size_t loadCount() const { return m_loadCount; }
+    uint64_t loadTime() const { return m_loadTime; }
 
 private:
+    // read-only mapping of a cache data file
+    struct CodeCacheMappedFile {
+        char* m_data;
+        size_t m_size;
+    };
+
     std::string m_cacheDirPath;
 
     CodeCacheContext m_currentContext; // current CodeCache infos
@@ -283,6 +313,10 @@ private:
     CodeCacheListMap m_cacheList;
     typedef std::unordered_map<CodeCacheIndex::ScriptID, uint64_t, std::hash<CodeCacheIndex::ScriptID>, std::equal_to<CodeCacheIndex::ScriptID>, std::allocator<std::pair<CodeCacheIndex::ScriptID const, uint64_t>>> CodeCacheLRUList; /* <Hash, TimeStamp> */
     CodeCacheLRUList m_cacheLRUList;
+    // data files are mapped on their first loading and kept until the file is changed or removed
+    // so loading each function of the same script does not map the file again
+    typedef std::unordered_map<CodeCacheIndex::ScriptID, CodeCacheMappedFile, std::hash<CodeCacheIndex::ScriptID>, std::equal_to<CodeCacheIndex::ScriptID>, std::allocator<std::pair<CodeCacheIndex::ScriptID const, CodeCacheMappedFile>>> CodeCacheMappedFileMap;
+    CodeCacheMappedFileMap m_mappedCacheFiles;
 
     CodeCacheWriter* m_cacheWriter;
     CodeCacheReader* m_cacheReader;
@@ -294,6 +328,10 @@ private:
 
     size_t m_minSourceLength;
     size_t m_maxCacheCount;
+    size_t m_hotFunctionExecutionCount;
+
+    size_t m_loadCount; // number of cache loadings (global and function)
+    uint64_t m_loadTime; // total time of cache loadings in microseconds
 
     void initialize(const char* baseCacheDir);
     bool tryInitCacheDir();
@@ -308,13 +346,15 @@ private:
 
     bool removeLRUCacheEntry();
     bool removeCacheFile(const CodeCacheIndex::ScriptID& scriptID);
+    void unmapCacheFile(const CodeCacheIndex::ScriptID& scriptID);
+    void unmapAllCacheFiles();
 
     void prepareCacheLoading(Context* context, const CodeCacheIndex& cacheIndex, const CodeCacheEntry& entry);
     bool postCacheLoading();
     CacheStringTable* loadCacheStringTable(Context* context);
     InterpretedCodeBlock* loadCodeBlockTree(Context* context, Script* script);
     ByteCodeBlock* loadByteCodeBlock(Context* context, InterpretedCodeBlock* topCodeBlock);
-    void loadAllByteCodeBlockOfFunctions(Context* context, std::vector<InterpretedCodeBlock*>& codeBlockVector, Script* script);
+    void loadAllByteCodeBlockOfFunctions(Context* context, std::vector<InterpretedCodeBlock*>& codeBlockVector, Script* script, size_t minExecutionCount);
 
     void prepareCacheWriting(const CodeCacheIndex& cacheIndex);
     bool postCacheWriting(const CodeCacheIndex& cacheIndex);
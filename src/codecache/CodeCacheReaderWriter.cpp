@@ -402,7 +402,7 @@ void CodeCacheWriter::storeByteCodeStream(ByteCodeBlock* block)
 
         while (code < end) {
             ByteCode* currentCode = reinterpret_cast<ByteCode*>(code);
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS)
             Opcode opcode = (Opcode)(size_t)currentCode->m_opcodeInAddress;
 #else
             Opcode opcode = currentCode->m_opcode;
@@ -651,14 +651,24 @@ void CodeCacheReader::CacheBuffer::resize(size_t size)
     m_capacity = size;
 }
 
+void CodeCacheReader::CacheBuffer::setMappedData(const char* data, size_t size)
+{
+    ASSERT(!m_buffer && m_capacity == 0 && m_index == 0);
+
+    m_buffer = const_cast<char*>(data);
+    m_capacity = size;
+    m_isMappedData = true;
+}
+
 void CodeCacheReader::CacheBuffer::reset()
 {
-    if (m_buffer) {
+    if (m_buffer && !m_isMappedData) {
         free(m_buffer);
-        m_buffer = nullptr;
     }
+    m_buffer = nullptr;
     m_capacity = 0;
     m_index = 0;
+    m_isMappedData = false;
 }
 
 bool CodeCacheReader::loadData(FILE* file, size_t size)
@@ -672,6 +682,11 @@ bool CodeCacheReader::loadData(FILE* file, size_t size)
     return true;
 }
 
+void CodeCacheReader::loadMappedData(const char* data, size_t size)
+{
+    m_buffer.setMappedData(data, size);
+}
+
 InterpretedCodeBlock* CodeCacheReader::loadInterpretedCodeBlock(Context* context, Script* script)
 {
     ASSERT(!!context);
@@ -999,7 +1014,7 @@ void CodeCacheReader::loadByteCodeStream(Context* context, ByteCodeBlock* block)
             ByteCodeRelocInfo& info = relocInfoVector[i];
             ByteCode* currentCode = reinterpret_cast<ByteCode*>(code + info.codeOffset);
 
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS)
             Opcode opcode = (Opcode)(size_t)currentCode->m_opcodeInAddress;
 #else
             Opcode opcode = currentCode->m_opcode;
@@ -233,6 +233,7 @@ public:
             : m_buffer(nullptr)
             , m_capacity(0)
             , m_index(0)
+            , m_isMappedData(false)
         {
         }
 
@@ -245,6 +246,8 @@ public:
         size_t size() const { return m_index; }
         size_t index() const { return m_index; }
         void resize(size_t size);
+        // read data in place from memory-mapped cache file (not owned by CacheBuffer)
+        void setMappedData(const char* data, size_t size);
         void reset();
 
         template <typename IntegralType>
@@ -306,6 +309,7 @@ public:
         char* m_buffer;
         size_t m_capacity;
         size_t m_index;
+        bool m_isMappedData;
     };
 
     CodeCacheReader()
@@ -334,6 +338,7 @@ public:
     size_t bufferIndex() const { return m_buffer.index(); }
     void clearBuffer() { m_buffer.reset(); }
     bool loadData(FILE*, size_t);
+    void loadMappedData(const char* data, size_t size);
 
     InterpretedCodeBlock* loadInterpretedCodeBlock(Context* context, Script* script);
     ByteCodeBlock* loadByteCodeBlock(Context* context, InterpretedCodeBlock* topCodeBlock);
@@ -854,7 +854,7 @@ bool DebuggerRemote::processEvents(ExecutionState* state, Optional<ByteCodeBlock
 
             ByteCode* breakpoint = (ByteCode*)(ptr + offset);
 
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS)
             if (buffer[1] != 0) {
                 if (breakpoint->m_opcodeInAddress != g_opcodeTable.m_addressTable[BreakpointDisabledOpcode]) {
                     break;
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "ArrayBufferAllocator.h"
+
+#if defined(OS_POSIX)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Escargot {
+
+#define ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MIN 16
+
+static_assert((ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX & (ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX - 1)) == 0, "small size max should be power of 2");
+static_assert(ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX < ARRAY_BUFFER_ALLOCATOR_LARGE_SIZE_MIN, "small buffers should not be mapped directly");
+
+static constexpr size_t smallSizeClassCount(size_t size)
+{
+    return size <= ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MIN ? 1 : 1 + smallSizeClassCount(size / 2);
+}
+
+struct ArrayBufferPool {
+    size_t m_count;
+    void* m_buffers[ARRAY_BUFFER_ALLOCATOR_POOL_SIZE];
+};
+
+// freed buffer can be pushed into the pool of another thread (e.g. SharedArrayBuffer)
+// it is fine because every pooled buffer is allocated by malloc
+static MAY_THREAD_LOCAL ArrayBufferPool s_pools[smallSizeClassCount(ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX)];
+static bool s_hugePageEnabled;
+
+static ALWAYS_INLINE size_t smallSizeClassIndex(size_t size, size_t& classSize)
+{
+    ASSERT(size <= ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX);
+    size_t index = 0;
+    classSize = ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MIN;
+    while (classSize < size) {
+        classSize <<= 1;
+        index++;
+    }
+    return index;
+}
+
+#if defined(OS_POSIX)
+static size_t pageSize()
+{
+    static size_t s_pageSize = sysconf(_SC_PAGESIZE);
+    return s_pageSize;
+}
+
+static size_t roundUpToPageSize(size_t size)
+{
+    size_t page = pageSize();
+    return (size + page - 1) & ~(page - 1);
+}
+
+static void adviseHugePage(void* buffer, size_t mappedSize)
+{
+#if defined(MADV_HUGEPAGE)
+    if (s_hugePageEnabled && mappedSize >= ARRAY_BUFFER_ALLOCATOR_HUGE_PAGE_SIZE_MIN) {
+        madvise(buffer, mappedSize, MADV_HUGEPAGE);
+    }
+#else
+    UNUSED_PARAMETER(buffer);
+    UNUSED_PARAMETER(mappedSize);
+#endif
+}
+
+static void* allocateLargeBuffer(size_t size)
+{
+    size_t mappedSize = roundUpToPageSize(size);
+    // anonymous mapping is zero-filled when each page is touched first
+    void* buffer = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (UNLIKELY(buffer == MAP_FAILED)) {
+        return nullptr;
+    }
+    adviseHugePage(buffer, mappedSize);
+    return buffer;
+}
+#endif
+
+static ALWAYS_INLINE bool isLargeBuffer(size_t size)
+{
+#if defined(OS_POSIX)
+    return size >= ARRAY_BUFFER_ALLOCATOR_LARGE_SIZE_MIN;
+#else
+    UNUSED_PARAMETER(size);
+    return false;
+#endif
+}
+
+void* ArrayBufferAllocator::allocate(size_t size)
+{
+    if (size <= ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX) {
+        size_t classSize;
+        ArrayBufferPool& pool = s_pools[smallSizeClassIndex(size, classSize)];
+        if (pool.m_count) {
+            void* buffer = pool.m_buffers[--pool.m_count];
+            // bytes after `size` are cleared by reallocate when they are exposed
+            memset(buffer, 0, size);
+            return buffer;
+        }
+        return calloc(classSize, 1);
+    }
+
+#if defined(OS_POSIX)
+    if (isLargeBuffer(size)) {
+        return allocateLargeBuffer(size);
+    }
+#endif
+
+    return calloc(size, 1);
+}
+
+void ArrayBufferAllocator::free(void* buffer, size_t size)
+{
+    if (!buffer) {
+        return;
+    }
+
+    if (size <= ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX) {
+        size_t classSize;
+        ArrayBufferPool& pool = s_pools[smallSizeClassIndex(size, classSize)];
+        if (pool.m_count < ARRAY_BUFFER_ALLOCATOR_POOL_SIZE) {
+            pool.m_buffers[pool.m_count++] = buffer;
+            return;
+        }
+        ::free(buffer);
+        return;
+    }
+
+#if defined(OS_POSIX)
+    if (isLargeBuffer(size)) {
+        munmap(buffer, roundUpToPageSize(size));
+        return;
+    }
+#endif
+
+    ::free(buffer);
+}
+
+void* ArrayBufferAllocator::reallocate(void* buffer, size_t oldSize, size_t newSize)
+{
+    if (!buffer) {
+        return allocate(newSize);
+    }
+
+    if (oldSize <= ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX && newSize <= ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX) {
+        size_t oldClassSize, newClassSize;
+        if (smallSizeClassIndex(oldSize, oldClassSize) == smallSizeClassIndex(newSize, newClassSize)) {
+            // fits in the same size class
+            if (oldSize < newSize) {
+                memset(static_cast<uint8_t*>(buffer) + oldSize, 0, newSize - oldSize);
+            }
+            return buffer;
+        }
+    }
+
+#if defined(OS_POSIX) && defined(MREMAP_MAYMOVE)
+    if (isLargeBuffer(oldSize) && isLargeBuffer(newSize)) {
+        size_t oldMappedSize = roundUpToPageSize(oldSize);
+        size_t newMappedSize = roundUpToPageSize(newSize);
+        // pages are moved without copying, newly added pages are zero-filled
+        void* newBuffer = mremap(buffer, oldMappedSize, newMappedSize, MREMAP_MAYMOVE);
+        if (LIKELY(newBuffer != MAP_FAILED)) {
+            if (oldSize < newSize) {
+                // tail of the last old page could be used before shrinking
+                memset(static_cast<uint8_t*>(newBuffer) + oldSize, 0, std::min(newSize, oldMappedSize) - oldSize);
+            }
+            adviseHugePage(newBuffer, newMappedSize);
+            return newBuffer;
+        }
+        return nullptr;
+    }
+#endif
+
+    if (!isLargeBuffer(oldSize) && !isLargeBuffer(newSize) && oldSize > ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX && newSize > ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX) {
+        void* newBuffer = realloc(buffer, newSize);
+        if (newBuffer && oldSize < newSize) {
+            memset(static_cast<uint8_t*>(newBuffer) + oldSize, 0, newSize - oldSize);
+        }
+        return newBuffer;
+    }
+
+    // buffer moves between different kinds of allocation
+    void* newBuffer = allocate(newSize);
+    if (LIKELY(!!newBuffer)) {
+        memcpy(newBuffer, buffer, std::min(oldSize, newSize));
+        free(buffer, oldSize);
+    }
+    return newBuffer;
+}
+
+void ArrayBufferAllocator::setHugePageEnabled(bool enabled)
+{
+    s_hugePageEnabled = enabled;
+}
+
+void ArrayBufferAllocator::releasePooledBuffers()
+{
+    for (size_t i = 0; i < smallSizeClassCount(ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX); i++) {
+        ArrayBufferPool& pool = s_pools[i];
+        while (pool.m_count) {
+            ::free(pool.m_buffers[--pool.m_count]);
+        }
+    }
+}
+} // namespace Escargot
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotArrayBufferAllocator__
+#define __EscargotArrayBufferAllocator__
+
+#ifndef ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX
+#define ARRAY_BUFFER_ALLOCATOR_SMALL_SIZE_MAX 4096
+#endif
+
+// max count of pooled buffers for each small size class
+#ifndef ARRAY_BUFFER_ALLOCATOR_POOL_SIZE
+#define ARRAY_BUFFER_ALLOCATOR_POOL_SIZE 32
+#endif
+
+#ifndef ARRAY_BUFFER_ALLOCATOR_LARGE_SIZE_MIN
+#define ARRAY_BUFFER_ALLOCATOR_LARGE_SIZE_MIN (64 * 1024)
+#endif
+
+#ifndef ARRAY_BUFFER_ALLOCATOR_HUGE_PAGE_SIZE_MIN
+#define ARRAY_BUFFER_ALLOCATOR_HUGE_PAGE_SIZE_MIN (2 * 1024 * 1024)
+#endif
+
+namespace Escargot {
+
+// default allocator of ArrayBuffer data
+// small buffers are pooled per size class on each thread
+// large buffers are mapped directly, so the kernel zero-fills them lazily and they can grow in place
+class ArrayBufferAllocator {
+public:
+    // returns zero-filled memory
+    static void* allocate(size_t size);
+    // size should be the one used for allocate or reallocate
+    static void free(void* buffer, size_t size);
+    static void* reallocate(void* buffer, size_t oldSize, size_t newSize);
+
+    // use transparent huge pages for large buffers (if OS supports)
+    static void setHugePageEnabled(bool enabled);
+    // give pooled buffers of the current thread back to malloc
+    static void releasePooledBuffers();
+};
+} // namespace Escargot
+
+#endif
@@ -23,6 +23,7 @@
 
 #include "runtime/Value.h"
 #include "runtime/ArrayObject.h"
+#include "runtime/ObjectStructure.h"
 #include "runtime/ArrayBufferObject.h"
 #include "runtime/WeakRefObject.h"
 #include "runtime/WeakMapObject.h"
@@ -30,10 +31,85 @@
 #include "parser/CodeBlock.h"
 #include "interpreter/ByteCode.h"
 
+#if defined(NDEBUG) && !defined(GC_DEBUG)
+#define ENABLE_KIND_ALLOCATION_CACHE
+#include <gc/gc_inline.h>
+#endif
+
 namespace Escargot {
 
 static MAY_THREAD_LOCAL int s_gcKinds[HeapObjectKind::NumberOfKind];
 
+#if defined(ENABLE_KIND_ALLOCATION_CACHE)
+#ifndef KIND_ALLOCATION_CACHE_SIZE
+#define KIND_ALLOCATION_CACHE_SIZE 128
+#endif
+
+// per-thread cache of fixed size objects of a gc kind
+// it is refilled by one batch allocation of bdwgc instead of taking the slow path of GC_generic_malloc for each object
+// the cache itself is uncollectable so gc cannot reclaim reserved objects
+struct KindAllocationCache {
+    size_t m_count;
+    void* m_objects[KIND_ALLOCATION_CACHE_SIZE];
+};
+
+static MAY_THREAD_LOCAL KindAllocationCache* s_arrayObjectAllocationCache;
+
+static NEVER_INLINE void* refillKindAllocationCache(KindAllocationCache*& cache, size_t size, int kind)
+{
+    if (UNLIKELY(!cache)) {
+        cache = reinterpret_cast<KindAllocationCache*>(GC_MALLOC_UNCOLLECTABLE(sizeof(KindAllocationCache)));
+        cache->m_count = 0;
+    }
+    ASSERT(cache->m_count == 0);
+
+    // GC_generic_malloc_many takes the size in multiple of granule
+    size_t allocationSize = (size + GC_GRANULE_BYTES - 1) & ~static_cast<size_t>(GC_GRANULE_BYTES - 1);
+    void* list = nullptr;
+    GC_generic_malloc_many(allocationSize, kind, &list);
+    if (UNLIKELY(!list)) {
+        return GC_GENERIC_MALLOC(size, kind);
+    }
+
+    // objects are linked through their first word, others are already cleared
+    void* result = list;
+    list = *reinterpret_cast<void**>(result);
+    *reinterpret_cast<void**>(result) = nullptr;
+    while (list && cache->m_count < KIND_ALLOCATION_CACHE_SIZE) {
+        void* next = *reinterpret_cast<void**>(list);
+        *reinterpret_cast<void**>(list) = nullptr;
+        cache->m_objects[cache->m_count++] = list;
+        list = next;
+    }
+    // a batch can be larger than the cache (e.g. small objects on 32-bit)
+    // return the rest to the free list now instead of leaving them until the next gc
+    while (list) {
+        void* next = *reinterpret_cast<void**>(list);
+        GC_FREE(list);
+        list = next;
+    }
+    return result;
+}
+
+static ALWAYS_INLINE void* allocateFromKindAllocationCache(KindAllocationCache*& cache, size_t size, int kind)
+{
+    if (LIKELY(cache && cache->m_count)) {
+        return cache->m_objects[--cache->m_count];
+    }
+    return refillKindAllocationCache(cache, size, kind);
+}
+#endif
+
+void clearCustomAllocatorCaches()
+{
+#if defined(ENABLE_KIND_ALLOCATION_CACHE)
+    if (s_arrayObjectAllocationCache) {
+        GC_FREE(s_arrayObjectAllocationCache);
+        s_arrayObjectAllocationCache = nullptr;
+    }
+#endif
+}
+
 template <GC_get_next_pointer_proc proc>
 GC_ms_entry* markAndPushCustomIterable(GC_word* addr,
                                        struct GC_ms_entry* mark_stack_ptr,
@@ -266,6 +342,19 @@ void initializeCustomAllocators()
                                                                          TRUE);
 #endif
 
+    // property tables are scanned conservatively like GC_MALLOC
+    s_gcKinds[HeapObjectKind::ObjectStructureItemVectorKind] = GC_new_kind(GC_new_free_list(),
+                                                                           0 | GC_DS_LENGTH,
+                                                                           TRUE,
+                                                                           TRUE);
+
+    // transition tables hold structures as weak references(disappearing links)
+    // so they should not be scanned
+    s_gcKinds[HeapObjectKind::ObjectStructureTransitionVectorKind] = GC_new_kind(GC_new_free_list(),
+                                                                                 0 | GC_DS_LENGTH,
+                                                                                 FALSE,
+                                                                                 TRUE);
+
 #ifdef NDEBUG
     GC_word objBitmap[GC_BITMAP_SIZE(ArrayObject)] = { 0 };
     GC_set_bit(objBitmap, GC_WORD_OFFSET(ArrayObject, m_structure));
@@ -316,6 +405,36 @@ void initializeCustomAllocators()
 #endif
 }
 
+const char* heapObjectKindName(int gcKind)
+{
+    static const char* names[HeapObjectKind::NumberOfKind] = {
+        "ValueVector",
+        "GetObjectInlineCacheDataVector",
+        "SetObjectInlineCacheDataVector",
+#if defined(ESCARGOT_64) && defined(ESCARGOT_USE_32BIT_IN_64BIT)
+        "EncodedSmallValueVector",
+#endif
+        "ObjectStructureItemVector",
+        "ObjectStructureTransitionVector",
+        "ArrayObject",
+#if !defined(NDEBUG)
+        "ArrayBufferObject",
+        "InterpretedCodeBlock",
+        "InterpretedCodeBlockWithRareData",
+        "WeakRefObject",
+        "FinalizationRegistryObjectItem",
+        "WeakMapObjectDataItem",
+#endif
+    };
+
+    for (size_t i = 0; i < HeapObjectKind::NumberOfKind; i++) {
+        if (s_gcKinds[i] == gcKind) {
+            return names[i];
+        }
+    }
+    return nullptr;
+}
+
 void iterateSpecificKindOfObject(ExecutionState& state, HeapObjectKind kind, HeapObjectIteratorCallback callback)
 {
     struct HeapObjectIteratorData {
@@ -326,6 +445,7 @@ void iterateSpecificKindOfObject(ExecutionState& state, HeapObjectKind kind, Hea
 
     HeapObjectIteratorData data{ s_gcKinds[kind], state, callback };
 
+    clearCustomAllocatorCaches();
     ASSERT(!GC_is_disabled());
     GC_gcollect(); // Update mark status. See comments of iterateSpecificKindOfObject in src/heap/Allocator.h
     GC_disable();
@@ -347,6 +467,35 @@ void iterateSpecificKindOfObject(ExecutionState& state, HeapObjectKind kind, Hea
     GC_enable();
 }
 
+void measureHeapObjectKindUsage(HeapObjectKindUsage usage[HeapObjectKind::NumberOfKind])
+{
+    for (size_t i = 0; i < HeapObjectKind::NumberOfKind; i++) {
+        usage[i].count = 0;
+        usage[i].bytes = 0;
+    }
+
+    clearCustomAllocatorCaches();
+    ASSERT(!GC_is_disabled());
+    GC_gcollect(); // Update mark status
+    GC_disable();
+    GC_enumerate_reachable_objects_inner([](void* obj, size_t bytes, void* cd) {
+        size_t size;
+        int kind = GC_get_kind_and_size(obj, &size);
+        ASSERT(size == bytes);
+
+        HeapObjectKindUsage* usage = (HeapObjectKindUsage*)cd;
+        for (size_t i = 0; i < HeapObjectKind::NumberOfKind; i++) {
+            if (s_gcKinds[i] == kind) {
+                usage[i].count++;
+                usage[i].bytes += size;
+                break;
+            }
+        }
+    },
+                                         (void*)usage);
+    GC_enable();
+}
+
 template <>
 Value* CustomAllocator<Value>::allocate(size_type GC_n, const void*)
 {
@@ -414,6 +563,28 @@ EncodedSmallValue* CustomAllocator<EncodedSmallValue>::allocate(size_type GC_n,
 }
 #endif
 
+template <>
+ObjectStructureItem* CustomAllocator<ObjectStructureItem>::allocate(size_type GC_n, const void*)
+{
+    int kind = s_gcKinds[HeapObjectKind::ObjectStructureItemVectorKind];
+    size_t size = sizeof(ObjectStructureItem) * GC_n;
+
+    ObjectStructureItem* ret;
+    ret = (ObjectStructureItem*)GC_GENERIC_MALLOC(size, kind);
+    return ret;
+}
+
+template <>
+ObjectStructureTransitionVectorItem* CustomAllocator<ObjectStructureTransitionVectorItem>::allocate(size_type GC_n, const void*)
+{
+    int kind = s_gcKinds[HeapObjectKind::ObjectStructureTransitionVectorKind];
+    size_t size = sizeof(ObjectStructureTransitionVectorItem) * GC_n;
+
+    ObjectStructureTransitionVectorItem* ret;
+    ret = (ObjectStructureTransitionVectorItem*)GC_GENERIC_MALLOC(size, kind);
+    return ret;
+}
+
 template <>
 ArrayObject* CustomAllocator<ArrayObject>::allocate(size_type GC_n, const void*)
 {
@@ -421,7 +592,11 @@ ArrayObject* CustomAllocator<ArrayObject>::allocate(size_type GC_n, const void*)
     // return (ArrayObject*)GC_MALLOC(sizeof(ArrayObject));
     ASSERT(GC_n == 1);
     int kind = s_gcKinds[HeapObjectKind::ArrayObjectKind];
+#if defined(ENABLE_KIND_ALLOCATION_CACHE)
+    return (ArrayObject*)allocateFromKindAllocationCache(s_arrayObjectAllocationCache, sizeof(ArrayObject), kind);
+#else
     return (ArrayObject*)GC_GENERIC_MALLOC(sizeof(ArrayObject), kind);
+#endif
 }
 
 #if !defined(NDEBUG)
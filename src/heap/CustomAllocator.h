@@ -54,6 +54,8 @@ enum HeapObjectKind : unsigned {
 #if defined(ESCARGOT_64) && defined(ESCARGOT_USE_32BIT_IN_64BIT)
     EncodedSmallValueVectorKind,
 #endif
+    ObjectStructureItemVectorKind,
+    ObjectStructureTransitionVectorKind,
     ArrayObjectKind,
 #if !defined(NDEBUG)
     ArrayBufferObjectKind,
@@ -68,6 +70,22 @@ enum HeapObjectKind : unsigned {
 
 void initializeCustomAllocators();
 
+// drop objects reserved by per-thread allocation caches
+// call this before enumerating objects of a kind, reserved objects are reachable but not initialized
+void clearCustomAllocatorCaches();
+
+// returns the name of HeapObjectKind allocated with given gc kind or nullptr
+const char* heapObjectKindName(int gcKind);
+
+struct HeapObjectKindUsage {
+    size_t count;
+    size_t bytes;
+};
+
+// measure reachable objects of every HeapObjectKind
+// like iterateSpecificKindOfObject, it calls GC_gcollect() to get precise mark status
+void measureHeapObjectKindUsage(HeapObjectKindUsage usage[HeapObjectKind::NumberOfKind]);
+
 typedef std::function<void(ExecutionState& state, void* obj)> HeapObjectIteratorCallback;
 
 /*
@@ -22,15 +22,42 @@
 #include "Heap.h"
 #include "LeakChecker.h"
 
+#include <unordered_map>
+
 namespace Escargot {
 
+static size_t g_markerThreadCount;
+static size_t g_incrementalPauseTarget;
+
+void Heap::setMarkerThreadCount(size_t count)
+{
+    g_markerThreadCount = count;
+}
+
+void Heap::setIncrementalPauseTarget(size_t milliseconds)
+{
+    g_incrementalPauseTarget = milliseconds;
+}
+
 void Heap::initialize()
 {
     // disable data area searching in bdwgc
     GC_set_no_dls(1);
+#if defined(ENABLE_GC_PARALLEL_MARK)
+    if (g_markerThreadCount) {
+        // count includes the thread which runs gc
+        GC_set_markers_count(static_cast<unsigned>(g_markerThreadCount));
+    }
+#endif
     GC_init();
     RELEASE_ASSERT(GC_get_all_interior_pointers() == 0);
 
+#if defined(ENABLE_GC_PARALLEL_MARK)
+    // bdwgc may defer creating marker threads until another thread is registered
+    // start them here so that the first collection of a single-threaded program is marked in parallel too
+    GC_start_mark_threads();
+#endif
+
 #if defined(OS_ANDROID)
     GC_set_abort_func([](const char* msg) {
         ESCARGOT_LOG_ERROR("%s", msg);
@@ -42,6 +69,14 @@ void Heap::initialize()
 #endif
 
     GC_set_force_unmap_on_gcollect(1);
+
+    if (g_incrementalPauseTarget) {
+        // there is no write barrier in escargot
+        // bdwgc tracks dirty pages by itself (soft-dirty bits or mprotect) in incremental mode
+        GC_enable_incremental();
+        GC_set_time_limit(g_incrementalPauseTarget);
+    }
+
     initializeCustomAllocators();
 
 #ifdef PROFILE_BDWGC
@@ -51,6 +86,7 @@ void Heap::initialize()
 
 void Heap::finalize()
 {
+    clearCustomAllocatorCaches();
     for (size_t i = 0; i < 5; i++) {
         GC_gcollect_and_unmap();
     }
@@ -65,4 +101,190 @@ void Heap::printGCHeapUsage()
     ESCARGOT_LOG_INFO("Compile Escargot with ESCARGOT_MEM_STATS option.\n");
 #endif
 }
+struct HeapSnapshotNode {
+    void* m_base;
+    size_t m_size;
+    int m_kind;
+    size_t m_firstEdge;
+    size_t m_edgeCount;
+    size_t m_retainerCount;
+};
+
+struct HeapSnapshotEdge {
+    size_t m_wordIndex;
+    size_t m_to;
+};
+
+static void writeHeapSnapshotString(FILE* fp, const char* str)
+{
+    fputc('"', fp);
+    for (const char* c = str; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', fp);
+        }
+        fputc(*c, fp);
+    }
+    fputc('"', fp);
+}
+
+bool Heap::writeHeapSnapshot(const char* filePath)
+{
+    FILE* fp = fopen(filePath, "w");
+    if (!fp) {
+        return false;
+    }
+
+    // node 0 is the synthetic root
+    std::vector<HeapSnapshotNode> nodes;
+    std::vector<HeapSnapshotEdge> edges;
+    std::unordered_map<void*, size_t> nodeIndex;
+    nodes.push_back(HeapSnapshotNode{ nullptr, 0, -1, 0, 0, 0 });
+
+    // update mark bits first, only the marked objects are enumerated
+    clearCustomAllocatorCaches();
+    GC_gcollect();
+    GC_disable();
+    GC_enumerate_reachable_objects_inner([](void* obj, size_t bytes, void* cd) {
+        size_t size;
+        int kind = GC_get_kind_and_size(obj, &size);
+        auto* nodes = reinterpret_cast<std::vector<HeapSnapshotNode>*>(cd);
+        nodes->push_back(HeapSnapshotNode{ obj, size, kind, 0, 0, 0 });
+    },
+                                         &nodes);
+
+    nodeIndex.reserve(nodes.size());
+    for (size_t i = 1; i < nodes.size(); i++) {
+        nodeIndex[nodes[i].m_base] = i;
+    }
+
+    for (size_t i = 1; i < nodes.size(); i++) {
+        HeapSnapshotNode& node = nodes[i];
+        node.m_firstEdge = edges.size();
+        if (node.m_kind == GC_I_PTRFREE) {
+            continue;
+        }
+        void** words = reinterpret_cast<void**>(node.m_base);
+        size_t wordCount = node.m_size / sizeof(void*);
+        for (size_t w = 0; w < wordCount; w++) {
+            void* base = words[w] ? GC_base(words[w]) : nullptr;
+            if (base && base != node.m_base) {
+                auto iter = nodeIndex.find(base);
+                if (iter != nodeIndex.end()) {
+                    edges.push_back(HeapSnapshotEdge{ w, iter->second });
+                    nodes[iter->second].m_retainerCount++;
+                }
+            }
+        }
+        node.m_edgeCount = edges.size() - node.m_firstEdge;
+    }
+    GC_enable();
+
+    // objects without any retainer in the heap are held by the real roots (stacks, registers, uncollectable memory)
+    std::vector<HeapSnapshotEdge> rootEdges;
+    std::vector<bool> visited(nodes.size(), false);
+    std::vector<size_t> worklist;
+    auto visitFrom = [&](size_t start) {
+        visited[start] = true;
+        worklist.push_back(start);
+        while (worklist.size()) {
+            const HeapSnapshotNode& node = nodes[worklist.back()];
+            worklist.pop_back();
+            for (size_t e = node.m_firstEdge; e < node.m_firstEdge + node.m_edgeCount; e++) {
+                if (!visited[edges[e].m_to]) {
+                    visited[edges[e].m_to] = true;
+                    worklist.push_back(edges[e].m_to);
+                }
+            }
+        }
+    };
+    for (size_t i = 1; i < nodes.size(); i++) {
+        if (nodes[i].m_retainerCount == 0) {
+            rootEdges.push_back(HeapSnapshotEdge{ rootEdges.size(), i });
+            visitFrom(i);
+        }
+    }
+    // objects which are retained only by a cycle are held by the real roots too
+    // link one object of each of these cycles to root, the others are reachable from it
+    for (size_t i = 1; i < nodes.size(); i++) {
+        if (!visited[i]) {
+            rootEdges.push_back(HeapSnapshotEdge{ rootEdges.size(), i });
+            visitFrom(i);
+        }
+    }
+
+    // string table: "", "(GC roots)" and one name per gc kind
+    // node types: hidden(0), array(1), object(3), synthetic(9)
+    std::vector<std::string> strings;
+    std::unordered_map<int, std::pair<size_t, int>> kindInfo;
+    strings.push_back("");
+    strings.push_back("(GC roots)");
+    for (size_t i = 1; i < nodes.size(); i++) {
+        int kind = nodes[i].m_kind;
+        if (kindInfo.find(kind) == kindInfo.end()) {
+            const char* name = heapObjectKindName(kind);
+            int type = 0;
+            if (name) {
+                strings.push_back(name);
+                if (strcmp(name, "ArrayObject") == 0) {
+                    type = 3;
+                } else if (strcmp(name, "ValueVector") == 0) {
+                    type = 1;
+                }
+            } else if (kind == GC_I_PTRFREE) {
+                strings.push_back("(atomic)");
+            } else if (kind == GC_I_NORMAL) {
+                strings.push_back("(normal)");
+            } else {
+                strings.push_back("(gc kind " + std::to_string(kind) + ")");
+            }
+            kindInfo[kind] = std::make_pair(strings.size() - 1, type);
+        }
+    }
+
+    const size_t nodeFieldCount = 7;
+    // every edge is written as element(1) with the word offset as its index
+    fputs("{\"snapshot\":{\"meta\":{"
+          "\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\",\"detachedness\"],"
+          "\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",\"number\",\"native\",\"synthetic\",\"concatenated string\",\"sliced string\",\"symbol\",\"bigint\",\"object shape\"],\"string\",\"number\",\"number\",\"number\",\"number\",\"number\"],"
+          "\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],"
+          "\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",\"weak\"],\"string_or_number\",\"node\"],"
+          "\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\",\"line\",\"column\"],"
+          "\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\",\"size\",\"children\"],"
+          "\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],"
+          "\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},",
+          fp);
+    fprintf(fp, "\"node_count\":%zu,\"edge_count\":%zu,\"trace_function_count\":0},\n", nodes.size(), edges.size() + rootEdges.size());
+
+    fputs("\"nodes\":[", fp);
+    fprintf(fp, "9,1,1,0,%zu,0,0", rootEdges.size());
+    for (size_t i = 1; i < nodes.size(); i++) {
+        const HeapSnapshotNode& node = nodes[i];
+        const auto& info = kindInfo[node.m_kind];
+        fprintf(fp, ",\n%d,%zu,%zu,%zu,%zu,0,0", info.second, info.first, i * 2 + 1, node.m_size, node.m_edgeCount);
+    }
+
+    fputs("],\n\"edges\":[", fp);
+    bool first = true;
+    for (size_t i = 0; i < rootEdges.size(); i++) {
+        fprintf(fp, "%s1,%zu,%zu", first ? "" : ",\n", rootEdges[i].m_wordIndex, rootEdges[i].m_to * nodeFieldCount);
+        first = false;
+    }
+    for (size_t i = 0; i < edges.size(); i++) {
+        fprintf(fp, "%s1,%zu,%zu", first ? "" : ",\n", edges[i].m_wordIndex, edges[i].m_to * nodeFieldCount);
+        first = false;
+    }
+
+    fputs("],\n\"trace_function_infos\":[],\"trace_tree\":[],\"samples\":[],\"locations\":[],\n\"strings\":[", fp);
+    for (size_t i = 0; i < strings.size(); i++) {
+        if (i) {
+            fputc(',', fp);
+        }
+        writeHeapSnapshotString(fp, strings[i].data());
+    }
+    fputs("]}\n", fp);
+
+    bool result = !ferror(fp);
+    fclose(fp);
+    return result;
+}
 } // namespace Escargot
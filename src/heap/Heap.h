@@ -28,6 +28,17 @@ public:
     static void initialize();
     static void finalize();
     static void printGCHeapUsage();
+    // write every reachable gc object into a file of .heapsnapshot (json) format
+    // edges are found by scanning every word of each object (except pointer-free ones) for gc pointers.
+    // typed descriptors and mark procedures of gc kinds are not used, so a non-pointer word
+    // which looks like a pointer makes a false edge
+    static bool writeHeapSnapshot(const char* filePath);
+
+    // collector configuration, these should be set before initialize
+    // marker thread count is used only when bdwgc is built with PARALLEL_MARK (ESCARGOT_GC_PARALLEL_MARK)
+    static void setMarkerThreadCount(size_t count);
+    // 0 means stop-the-world collection (default)
+    static void setIncrementalPauseTarget(size_t milliseconds);
 };
 } // namespace Escargot
 
@@ -103,6 +103,9 @@ ByteCodeBlock::ByteCodeBlock()
     , m_requiredOperandRegisterNumber(2)
     , m_requiredTotalRegisterNumber(0)
     , m_inlineCacheDataSize(0)
+    , m_executionCount(0)
+    , m_totalExecutionCount(0)
+    , m_lastUsedGCEpoch(0)
     , m_codeBlock(nullptr)
 {
     // This constructor is used to allocate a ByteCodeBlock on the stack
@@ -135,6 +138,9 @@ ByteCodeBlock::ByteCodeBlock(InterpretedCodeBlock* codeBlock)
     , m_requiredOperandRegisterNumber(2)
     , m_requiredTotalRegisterNumber(0)
     , m_inlineCacheDataSize(0)
+    , m_executionCount(0)
+    , m_totalExecutionCount(0)
+    , m_lastUsedGCEpoch(codeBlock->context()->vmInstance()->byteCodeGCEpoch())
     , m_codeBlock(codeBlock)
 {
     auto& v = m_codeBlock->context()->vmInstance()->compiledByteCodeBlocks();
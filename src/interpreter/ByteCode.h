@@ -42,6 +42,8 @@ struct GlobalVariableAccessCacheItem;
     F(LoadByHeapIndex)                                \
     F(StoreByHeapIndex)                               \
     F(InitializeByHeapIndex)                          \
+    F(LoadByBlockHeapIndex)                           \
+    F(StoreByBlockHeapIndex)                          \
     F(NewOperation)                                   \
     F(NewOperationWithSpreadElement)                  \
     F(BinaryPlus)                                     \
@@ -161,7 +163,12 @@ struct GlobalVariableAccessCacheItem;
     FOR_EACH_BYTECODE_DEBUGGER_OP(F) \
     FOR_EACH_BYTECODE_OP(F)
 
+#if defined(ENABLE_COMPACT_BYTECODE)
+// opcode is stored in 8-bit field. fixed unsigned type prevents reading it back as negative value
+enum Opcode : uint8_t {
+#else
 enum Opcode {
+#endif
 #define DECLARE_BYTECODE(name) name##Opcode,
     FOR_EACH_BYTECODE(DECLARE_BYTECODE)
 #undef DECLARE_BYTECODE
@@ -182,6 +189,11 @@ struct OpcodeTable {
 
 extern OpcodeTable g_opcodeTable;
 
+#if defined(ENABLE_COMPACT_BYTECODE)
+COMPILE_ASSERT(OpcodeKindEnd <= 256, "");
+COMPILE_ASSERT(SetObjectOpcodeSlowCaseOpcode < 256, "");
+#endif
+
 struct ByteCodeLOC {
     size_t index;
 #ifndef NDEBUG
@@ -199,17 +211,23 @@ struct ByteCodeLOC {
     }
 };
 
-#if defined(NDEBUG) && defined(ESCARGOT_32) && !defined(OS_WINDOWS)
+#if defined(NDEBUG) && defined(ESCARGOT_32) && !defined(OS_WINDOWS) && !defined(ENABLE_COMPACT_BYTECODE)
 #define BYTECODE_SIZE_CHECK_IN_32BIT(codeName, size) COMPILE_ASSERT(sizeof(codeName) == size, "");
 #else
 #define BYTECODE_SIZE_CHECK_IN_32BIT(CodeName, Size)
 #endif
 
 /* Byte code is never instantiated on the heap, it is part of the byte code stream. */
+#if defined(ENABLE_COMPACT_BYTECODE)
+// bytecodes are placed in a row in ByteCodeBlock, so every bytecode should keep word alignment
+// (compact opcode field does not guarantee it)
+class alignas(sizeof(size_t)) ByteCode {
+#else
 class ByteCode {
+#endif
 public:
     ByteCode(Opcode code, const ByteCodeLOC& loc)
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS)
         : m_opcodeInAddress((void*)code)
 #else
         : m_opcode(code)
@@ -223,7 +241,7 @@ public:
 
     void assignOpcodeInAddress()
     {
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS)
         m_opcodeInAddress = g_opcodeTable.m_addressTable[(Opcode)(size_t)m_opcodeInAddress];
 #endif
     }
@@ -231,7 +249,7 @@ public:
 #if defined(ENABLE_CODE_CACHE)
     void assignAddressInOpcode()
     {
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS)
         ASSERT(g_opcodeTable.m_opcodeMap.find(m_opcodeInAddress) != g_opcodeTable.m_opcodeMap.end());
         m_opcodeInAddress = (void*)g_opcodeTable.m_opcodeMap.find(m_opcodeInAddress)->second;
 #endif
@@ -240,15 +258,17 @@ public:
 
     void changeOpcode(Opcode code)
     {
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS)
         m_opcodeInAddress = g_opcodeTable.m_addressTable[code];
 #else
         m_opcode = code;
 #endif
     }
 
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS)
     void* m_opcodeInAddress;
+#elif defined(ENABLE_COMPACT_BYTECODE)
+    Opcode m_opcode : 8;
 #else
     Opcode m_opcode;
 #endif
@@ -445,6 +465,51 @@ public:
 #endif
 };
 
+// {Load, Store}ByHeapIndex for variables of heap-allocated lexical block
+// the target record is always DeclarativeEnvironmentRecordIndexed (decided by scope analysis)
+// so interpreter can access the storage without virtual call
+class LoadByBlockHeapIndex : public ByteCode {
+public:
+    LoadByBlockHeapIndex(const ByteCodeLOC& loc, const size_t registerIndex, const size_t upperIndex, const size_t index)
+        : ByteCode(Opcode::LoadByBlockHeapIndexOpcode, loc)
+        , m_registerIndex(registerIndex)
+        , m_upperIndex(upperIndex)
+        , m_index(index)
+    {
+    }
+    ByteCodeRegisterIndex m_registerIndex;
+    ByteCodeRegisterIndex m_upperIndex;
+    ByteCodeRegisterIndex m_index;
+
+#ifndef NDEBUG
+    void dump()
+    {
+        printf("load r%u <- block heap[%u][%u]", m_registerIndex, m_upperIndex, m_index);
+    }
+#endif
+};
+
+class StoreByBlockHeapIndex : public ByteCode {
+public:
+    StoreByBlockHeapIndex(const ByteCodeLOC& loc, const size_t registerIndex, const size_t upperIndex, const size_t index)
+        : ByteCode(Opcode::StoreByBlockHeapIndexOpcode, loc)
+        , m_registerIndex(registerIndex)
+        , m_upperIndex(upperIndex)
+        , m_index(index)
+    {
+    }
+    ByteCodeRegisterIndex m_registerIndex;
+    ByteCodeRegisterIndex m_upperIndex;
+    ByteCodeRegisterIndex m_index;
+
+#ifndef NDEBUG
+    void dump()
+    {
+        printf("store block heap[%u][%u] <- r%u", m_upperIndex, m_index, m_registerIndex);
+    }
+#endif
+};
+
 class CreateFunction : public ByteCode {
 public:
     CreateFunction(const ByteCodeLOC& loc, const size_t registerIndex, const size_t homeObjectRegisterIndex, InterpretedCodeBlock* cb)
@@ -2718,6 +2783,8 @@ public:
         IteratorNext,
         IteratorTestResultIsObject,
         IteratorValue,
+        // fused IteratorStep + IteratorValue for the case nextResult never escapes
+        IteratorStepValue,
         // https://www.ecma-international.org/ecma-262/10.0/#sec-asynciteratorclose (8)
         IteratorCheckOngoingExceptionOnAsyncIteratorClose
     };
@@ -2766,6 +2833,12 @@ public:
         ByteCodeRegisterIndex m_dstRegisterIndex;
     };
 
+    struct IteratorStepValueData {
+        ByteCodeRegisterIndex m_iteratorRecordRegisterIndex;
+        ByteCodeRegisterIndex m_dstRegisterIndex;
+        ByteCodeRegisterIndex m_doneRegisterIndex;
+    };
+
     struct IteratorCheckOngoingExceptionOnAsyncIteratorCloseData {
     };
 
@@ -2819,6 +2892,13 @@ public:
     {
     }
 
+    explicit IteratorOperation(const ByteCodeLOC& loc, const IteratorStepValueData& data)
+        : ByteCode(Opcode::IteratorOperationOpcode, loc)
+        , m_operation(Operation::IteratorStepValue)
+        , m_iteratorStepValueData(data)
+    {
+    }
+
     explicit IteratorOperation(const ByteCodeLOC& loc, const IteratorCheckOngoingExceptionOnAsyncIteratorCloseData& data)
         : ByteCode(Opcode::IteratorOperationOpcode, loc)
         , m_operation(Operation::IteratorCheckOngoingExceptionOnAsyncIteratorClose)
@@ -2845,6 +2925,9 @@ public:
             printf("iterator test result is object r%u", m_iteratorTestResultIsObjectData.m_valueRegisterIndex);
         } else if (m_operation == Operation::IteratorValue) {
             printf("iterator value r%u -> r%u", m_iteratorValueData.m_srcRegisterIndex, m_iteratorValueData.m_dstRegisterIndex);
+        } else if (m_operation == Operation::IteratorStepValue) {
+            printf("iterator step value r%u -> r%u, done -> r%u", m_iteratorStepValueData.m_iteratorRecordRegisterIndex,
+                   m_iteratorStepValueData.m_dstRegisterIndex, m_iteratorStepValueData.m_doneRegisterIndex);
         } else if (m_operation == Operation::IteratorCheckOngoingExceptionOnAsyncIteratorClose) {
             printf("iterator check ongoing exception");
         } else {
@@ -2863,6 +2946,7 @@ public:
         IteratorNextData m_iteratorNextData;
         IteratorTestResultIsObjectData m_iteratorTestResultIsObjectData;
         IteratorValueData m_iteratorValueData;
+        IteratorStepValueData m_iteratorStepValueData;
         IteratorCheckOngoingExceptionOnAsyncIteratorCloseData m_iteratorCheckOngoingExceptionOnAsyncIteratorCloseData;
     };
 };
@@ -3310,6 +3394,12 @@ public:
     // precomputed value of total register number which is "m_requiredTotalRegisterNumber + stack allocated variables size"
     ByteCodeRegisterIndex m_requiredTotalRegisterNumber : REGISTER_INDEX_IN_BIT;
     size_t m_inlineCacheDataSize;
+    // number of calls since last GC. VMInstance folds it into m_lastUsedGCEpoch on every GC
+    size_t m_executionCount;
+    // number of calls before last GC. stored as profile data of CodeCache
+    size_t m_totalExecutionCount;
+    // GC epoch of VMInstance when this block was used lastly. used for selecting prune victims
+    size_t m_lastUsedGCEpoch;
 
     ByteCodeBlockData m_code;
     ByteCodeNumeralLiteralData m_numeralLiteralData;
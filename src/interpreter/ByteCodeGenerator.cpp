@@ -386,7 +386,7 @@ void ByteCodeGenerator::relocateByteCode(ByteCodeBlock* block)
 
     while (code < end) {
         ByteCode* currentCode = (ByteCode*)code;
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS)
         Opcode opcode = (Opcode)(size_t)currentCode->m_opcodeInAddress;
 #else
         Opcode opcode = currentCode->m_opcode;
@@ -439,6 +439,16 @@ void ByteCodeGenerator::relocateByteCode(ByteCodeBlock* block)
             ASSIGN_STACKINDEX_IF_NEEDED(cd->m_registerIndex, stackBase, stackBaseWillBe, stackVariableSize);
             break;
         }
+        case LoadByBlockHeapIndexOpcode: {
+            LoadByBlockHeapIndex* cd = (LoadByBlockHeapIndex*)currentCode;
+            ASSIGN_STACKINDEX_IF_NEEDED(cd->m_registerIndex, stackBase, stackBaseWillBe, stackVariableSize);
+            break;
+        }
+        case StoreByBlockHeapIndexOpcode: {
+            StoreByBlockHeapIndex* cd = (StoreByBlockHeapIndex*)currentCode;
+            ASSIGN_STACKINDEX_IF_NEEDED(cd->m_registerIndex, stackBase, stackBaseWillBe, stackVariableSize);
+            break;
+        }
         case CreateFunctionOpcode: {
             CreateFunction* cd = (CreateFunction*)currentCode;
             ASSIGN_STACKINDEX_IF_NEEDED(cd->m_registerIndex, stackBase, stackBaseWillBe, stackVariableSize);
@@ -740,6 +750,10 @@ void ByteCodeGenerator::relocateByteCode(ByteCodeBlock* block)
             } else if (cd->m_operation == IteratorOperation::Operation::IteratorValue) {
                 ASSIGN_STACKINDEX_IF_NEEDED(cd->m_iteratorValueData.m_srcRegisterIndex, stackBase, stackBaseWillBe, stackVariableSize);
                 ASSIGN_STACKINDEX_IF_NEEDED(cd->m_iteratorValueData.m_dstRegisterIndex, stackBase, stackBaseWillBe, stackVariableSize);
+            } else if (cd->m_operation == IteratorOperation::Operation::IteratorStepValue) {
+                ASSIGN_STACKINDEX_IF_NEEDED(cd->m_iteratorStepValueData.m_iteratorRecordRegisterIndex, stackBase, stackBaseWillBe, stackVariableSize);
+                ASSIGN_STACKINDEX_IF_NEEDED(cd->m_iteratorStepValueData.m_dstRegisterIndex, stackBase, stackBaseWillBe, stackVariableSize);
+                ASSIGN_STACKINDEX_IF_NEEDED(cd->m_iteratorStepValueData.m_doneRegisterIndex, stackBase, stackBaseWillBe, stackVariableSize);
             } else if (cd->m_operation == IteratorOperation::Operation::IteratorCheckOngoingExceptionOnAsyncIteratorClose) {
             } else {
                 ASSERT_NOT_REACHED();
@@ -55,7 +55,7 @@
 #include "runtime/FunctionObjectInlines.h"
 #endif
 
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER) && !defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER_INIT_WITH_NULL)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS) && !defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER_INIT_WITH_NULL)
 extern char FillOpcodeTableAsmLbl[];
 const void* FillOpcodeTableAddress[] = { &FillOpcodeTableAsmLbl[0] };
 #endif
@@ -96,7 +96,9 @@ OpcodeTable::OpcodeTable()
 #if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
     // Dummy bytecode execution to initialize the OpcodeTable.
     ExecutionState state;
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER_INIT_WITH_NULL)
+#if defined(ENABLE_COMPACT_BYTECODE)
+    FillOpcodeTable dummyCode((ByteCodeLOC(SIZE_MAX)));
+#elif defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER_INIT_WITH_NULL)
     size_t dummyCode = 0;
 #else
     size_t dummyCode = reinterpret_cast<size_t>(FillOpcodeTableAddress[0]);
@@ -220,7 +222,11 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
     state->m_programCounter = &programCounter;
     {
 #if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
-#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER_INIT_WITH_NULL)
+#if defined(ENABLE_COMPACT_BYTECODE)
+        if (UNLIKELY(((ByteCode*)programCounter)->m_opcode == FillOpcodeTableOpcode)) {
+            goto FillOpcodeTableOpcodeLbl;
+        }
+#elif defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER_INIT_WITH_NULL)
         if (UNLIKELY((((ByteCode*)programCounter)->m_opcodeInAddress) == NULL)) {
             goto FillOpcodeTableOpcodeLbl;
         }
@@ -234,7 +240,11 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
 
     NextInstruction:
         /* Execute first instruction. */
+#if defined(ENABLE_COMPACT_BYTECODE)
+        goto*(g_opcodeTable.m_addressTable[((ByteCode*)programCounter)->m_opcode]);
+#else
         goto*(((ByteCode*)programCounter)->m_opcodeInAddress);
+#endif
 #else
 
 #define DEFINE_OPCODE(codeName) case codeName##Opcode
@@ -320,7 +330,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
 
             bool isCacheWork = false;
             if (LIKELY(idx != std::numeric_limits<size_t>::max())) {
-                if (LIKELY(ctx->globalDeclarativeStorage()->size() == slot->m_lexicalIndexCache && globalObject->structure() == slot->m_cachedStructure)) {
+                if (LIKELY(ctx->globalDeclarativeStorage()->size() == slot->m_lexicalIndexCache && globalObject->structure() == slot->m_cachedStructure && !slot->m_isCachedPropertyReadOnly)) {
                     ASSERT(globalObject->m_values.data() <= slot->m_cachedAddress);
                     ASSERT(slot->m_cachedAddress < (globalObject->m_values.data() + globalObject->structure()->propertyCount()));
                     *((ObjectPropertyValue*)slot->m_cachedAddress) = registerFile[code->m_registerIndex];
@@ -663,6 +673,10 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
         {
             Jump* code = (Jump*)programCounter;
             ASSERT(code->m_jumpPosition != SIZE_MAX);
+            if (code->m_jumpPosition < programCounter) {
+                // loop back-edge
+                state->context()->vmInstance()->checkHeapLimitIfExceeded(*state);
+            }
             programCounter = code->m_jumpPosition;
             NEXT_INSTRUCTION();
         }
@@ -708,6 +722,10 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             JumpIfTrue* code = (JumpIfTrue*)programCounter;
             ASSERT(code->m_jumpPosition != SIZE_MAX);
             if (registerFile[code->m_registerIndex].toBoolean()) {
+                if (code->m_jumpPosition < programCounter) {
+                    // back-edge of do-while loop
+                    state->context()->vmInstance()->checkHeapLimitIfExceeded(*state);
+                }
                 programCounter = code->m_jumpPosition;
             } else {
                 ADD_PROGRAM_COUNTER(JumpIfTrue);
@@ -810,6 +828,39 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             NEXT_INSTRUCTION();
         }
 
+        DEFINE_OPCODE(LoadByBlockHeapIndex)
+            :
+        {
+            LoadByBlockHeapIndex* code = (LoadByBlockHeapIndex*)programCounter;
+            // every activation has its own environment chain, so resolved record cannot be cached in bytecode
+            // only the name lookup and virtual dispatch are skipped here, the walk of m_upperIndex records is kept
+            LexicalEnvironment* upperEnv = state->lexicalEnvironment();
+            for (size_t i = 0; i < code->m_upperIndex; i++) {
+                upperEnv = upperEnv->outerEnvironment();
+            }
+            ASSERT(upperEnv->record()->isDeclarativeEnvironmentRecord() && upperEnv->record()->asDeclarativeEnvironmentRecord()->isDeclarativeEnvironmentRecordIndexed());
+            DeclarativeEnvironmentRecordIndexed* record = static_cast<DeclarativeEnvironmentRecordIndexed*>(upperEnv->record());
+            registerFile[code->m_registerIndex] = record->DeclarativeEnvironmentRecordIndexed::getHeapValueByIndex(*state, code->m_index);
+            ADD_PROGRAM_COUNTER(LoadByBlockHeapIndex);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(StoreByBlockHeapIndex)
+            :
+        {
+            StoreByBlockHeapIndex* code = (StoreByBlockHeapIndex*)programCounter;
+            // same as LoadByBlockHeapIndex, only virtual dispatch is skipped
+            LexicalEnvironment* upperEnv = state->lexicalEnvironment();
+            for (size_t i = 0; i < code->m_upperIndex; i++) {
+                upperEnv = upperEnv->outerEnvironment();
+            }
+            ASSERT(upperEnv->record()->isDeclarativeEnvironmentRecord() && upperEnv->record()->asDeclarativeEnvironmentRecord()->isDeclarativeEnvironmentRecordIndexed());
+            DeclarativeEnvironmentRecordIndexed* record = static_cast<DeclarativeEnvironmentRecordIndexed*>(upperEnv->record());
+            record->DeclarativeEnvironmentRecordIndexed::setMutableBindingByIndex(*state, code->m_index, registerFile[code->m_registerIndex]);
+            ADD_PROGRAM_COUNTER(StoreByBlockHeapIndex);
+            NEXT_INSTRUCTION();
+        }
+
         DEFINE_OPCODE(UnaryMinus)
             :
         {
@@ -1711,7 +1762,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
 #endif
 #if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
 
-#if !defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER_INIT_WITH_NULL)
+#if defined(ESCARGOT_BYTECODE_HAS_LABEL_ADDRESS) && !defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER_INIT_WITH_NULL)
             asm volatile("FillOpcodeTableAsmLbl:");
 #endif
 
@@ -2920,16 +2971,19 @@ NEVER_INLINE Value InterpreterSlowPath::getGlobalVariableSlowCase(ExecutionState
         }
     } else {
         const ObjectStructureItem* item = findResult.second.value();
-        if (!item->m_descriptor.isPlainDataProperty() || !item->m_descriptor.isWritable()) {
+        if (!item->m_descriptor.isPlainDataProperty()) {
             slot->m_cachedStructure = nullptr;
             slot->m_cachedAddress = nullptr;
             slot->m_lexicalIndexCache = std::numeric_limits<size_t>::max();
             return go->getOwnPropertyUtilForObject(state, findResult.first, go);
         }
 
+        // reading non-writable data property(NaN, Infinity...) through cache is safe
+        // because changing its attribute always changes structure of global object
         slot->m_cachedAddress = &go->m_values.data()[findResult.first];
         slot->m_cachedStructure = go->structure();
         slot->m_lexicalIndexCache = siz;
+        slot->m_isCachedPropertyReadOnly = !item->m_descriptor.isWritable();
         return *((ObjectPropertyValue*)slot->m_cachedAddress);
     }
 }
@@ -2978,6 +3032,7 @@ NEVER_INLINE void InterpreterSlowPath::setGlobalVariableSlowCase(ExecutionState&
         slot->m_cachedAddress = &go->m_values.data()[findResult.first];
         slot->m_cachedStructure = go->structure();
         slot->m_lexicalIndexCache = siz;
+        slot->m_isCachedPropertyReadOnly = false;
 
         go->setOwnPropertyThrowsExceptionWhenStrictMode(state, findResult.first, value, go);
     }
@@ -3217,7 +3272,14 @@ NEVER_INLINE void InterpreterSlowPath::createFunctionOperation(ExecutionState& s
     } else if (cb->isObjectMethod() || cb->isClassMethod() || cb->isClassStaticMethod()) {
         registerFile[code->m_registerIndex] = new ScriptClassMethodFunctionObject(state, proto, cb, outerLexicalEnvironment, registerFile[code->m_homeObjectRegisterIndex].asObject());
     } else {
-        registerFile[code->m_registerIndex] = new ScriptFunctionObject(state, proto, cb, outerLexicalEnvironment, true, false);
+        ScriptFunctionObject* fn = new ScriptFunctionObject(state, proto, cb, outerLexicalEnvironment, true, false);
+        if (cb->byteCodeBlock()) {
+            // ByteCodeBlock can be ready before the first call of this object
+            // (e.g. ScriptRef::precompileFunctions or other closure of the same code)
+            // call path is selected here once. otherwise it is selected when ByteCodeBlock is generated
+            fn->useSimpleFunctionCallPathIfPossible();
+        }
+        registerFile[code->m_registerIndex] = fn;
     }
 }
 
@@ -4561,12 +4623,11 @@ NEVER_INLINE void InterpreterSlowPath::createSpreadArrayObject(ExecutionState& s
     IteratorRecord* iteratorRecord = IteratorObject::getIterator(state, registerFile[code->m_argumentIndex]);
     size_t i = 0;
     while (true) {
-        auto next = IteratorObject::iteratorStep(state, iteratorRecord);
+        auto next = IteratorObject::iteratorStepValue(state, iteratorRecord);
         if (!next.hasValue()) {
             break;
         }
-        Value value = IteratorObject::iteratorValue(state, next.value());
-        spreadArray->setIndexedProperty(state, Value(i++), value, spreadArray);
+        spreadArray->setIndexedProperty(state, Value(i++), next.value(), spreadArray);
     }
     registerFile[code->m_registerIndex] = spreadArray;
 }
@@ -4788,29 +4849,23 @@ NEVER_INLINE void InterpreterSlowPath::iteratorOperation(ExecutionState& state,
     } else if (code->m_operation == IteratorOperation::Operation::IteratorBind) {
         auto strings = &state.context()->staticStrings();
 
-        Optional<Object*> nextResult;
+        Optional<Value> nextValue;
         Value value;
         IteratorRecord* iteratorRecord = registerFile[code->m_iteratorBindData.m_iterRegisterIndex].asPointerValue()->asIteratorRecord();
 
         if (!iteratorRecord->m_done) {
             try {
-                nextResult = IteratorObject::iteratorStep(state, iteratorRecord);
+                nextValue = IteratorObject::iteratorStepValue(state, iteratorRecord);
             } catch (const Value& e) {
                 Value exceptionValue = e;
                 iteratorRecord->m_done = true;
                 state.throwException(exceptionValue);
             }
 
-            if (!nextResult.hasValue()) {
+            if (!nextValue.hasValue()) {
                 iteratorRecord->m_done = true;
             } else {
-                try {
-                    value = IteratorObject::iteratorValue(state, nextResult.value());
-                } catch (const Value& e) {
-                    Value exceptionValue = e;
-                    iteratorRecord->m_done = true;
-                    state.throwException(exceptionValue);
-                }
+                value = nextValue.value();
             }
         }
 
@@ -4841,6 +4896,14 @@ NEVER_INLINE void InterpreterSlowPath::iteratorOperation(ExecutionState& state,
     } else if (code->m_operation == IteratorOperation::Operation::IteratorValue) {
         registerFile[code->m_iteratorValueData.m_dstRegisterIndex] = IteratorObject::iteratorValue(state, registerFile[code->m_iteratorValueData.m_srcRegisterIndex].asObject());
         ADD_PROGRAM_COUNTER(IteratorOperation);
+    } else if (code->m_operation == IteratorOperation::Operation::IteratorStepValue) {
+        auto record = registerFile[code->m_iteratorStepValueData.m_iteratorRecordRegisterIndex].asPointerValue()->asIteratorRecord();
+        auto value = IteratorObject::iteratorStepValue(state, record);
+        if (value.hasValue()) {
+            registerFile[code->m_iteratorStepValueData.m_dstRegisterIndex] = value.value();
+        }
+        registerFile[code->m_iteratorStepValueData.m_doneRegisterIndex] = Value(!value.hasValue());
+        ADD_PROGRAM_COUNTER(IteratorOperation);
     } else if (code->m_operation == IteratorOperation::Operation::IteratorCheckOngoingExceptionOnAsyncIteratorClose) {
         ControlFlowRecord* record = state.rareData()->controlFlowRecordVector()->back();
         if (record && record->reason() == ControlFlowRecord::NeedsThrow) {
@@ -4863,21 +4926,20 @@ NEVER_INLINE Object* InterpreterSlowPath::restBindOperation(ExecutionState& stat
     auto strings = &state.context()->staticStrings();
 
     Object* result = new ArrayObject(state);
-    Optional<Object*> nextResult;
-    Value value;
+    Optional<Value> nextValue;
     size_t index = 0;
 
     while (true) {
         if (!iteratorRecord->m_done) {
             try {
-                nextResult = IteratorObject::iteratorStep(state, iteratorRecord);
+                nextValue = IteratorObject::iteratorStepValue(state, iteratorRecord);
             } catch (const Value& e) {
                 Value exceptionValue = e;
                 iteratorRecord->m_done = true;
                 state.throwException(exceptionValue);
             }
 
-            if (!nextResult.hasValue()) {
+            if (!nextValue.hasValue()) {
                 iteratorRecord->m_done = true;
             }
         }
@@ -4886,15 +4948,7 @@ NEVER_INLINE Object* InterpreterSlowPath::restBindOperation(ExecutionState& stat
             break;
         }
 
-        try {
-            value = IteratorObject::iteratorValue(state, nextResult.value());
-        } catch (const Value& e) {
-            Value exceptionValue = e;
-            iteratorRecord->m_done = true;
-            state.throwException(exceptionValue);
-        }
-
-        result->setIndexedProperty(state, Value(index++), value);
+        result->setIndexedProperty(state, Value(index++), nextValue.value());
     }
 
     return result;
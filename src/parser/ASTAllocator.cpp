@@ -24,6 +24,7 @@
 namespace Escargot {
 
 ASTAllocator::ASTAllocator()
+    : m_peakPoolSize(0)
 {
     m_astPoolMemory = static_cast<char*>(malloc(astPoolSize()));
     m_astPoolEnd = m_astPoolMemory + astPoolSize();
@@ -35,6 +36,7 @@ ASTAllocator::~ASTAllocator()
     ASSERT(m_astPoolMemory == currentPool());
 
     free(currentPool());
+    releaseCachedPools();
 }
 
 void ASTAllocator::reset()
@@ -44,12 +46,33 @@ void ASTAllocator::reset()
     ASSERT(m_astPoolMemory != nullptr && m_astPoolEnd != nullptr);
     ASSERT(static_cast<size_t>(m_astPoolEnd - m_astPoolMemory) >= 0);
 
+    m_peakPoolSize = std::max(m_peakPoolSize, usedPoolSize());
+
+    // keep the pools used in this parsing (up to the limit in bytes) for the next one
+    // so that parsing of similar sized sources does not hit malloc again.
+    // the cache is released when the VM enters idle mode
     if (m_astPools.size()) {
+        m_astPools.push_back(m_astPoolEnd - astPoolSize());
         m_astPoolMemory = static_cast<char*>(m_astPools[0]);
 
-        free(m_astPoolEnd - astPoolSize());
-        for (size_t i = 1; i < m_astPools.size(); i++) {
-            free(m_astPools[i]);
+        size_t usedCount = m_astPools.size() - 1;
+        size_t keepCount = 0;
+        size_t keepSize = 0;
+        while (keepCount < usedCount && keepSize + astPoolSizeAt(keepCount + 1) <= AST_ALLOCATOR_MAX_CACHED_POOL_SIZE) {
+            keepSize += astPoolSizeAt(keepCount + 1);
+            keepCount++;
+        }
+        if (m_cachedPools.size() < keepCount) {
+            m_cachedPools.resize(keepCount, nullptr);
+        }
+        for (size_t i = 0; i < usedCount; i++) {
+            void* pool = m_astPools[i + 1];
+            if (i < keepCount) {
+                ASSERT(m_cachedPools[i] == nullptr);
+                m_cachedPools[i] = pool;
+            } else {
+                free(pool);
+            }
         }
         m_astPools.clear();
         m_astPoolEnd = m_astPoolMemory + astPoolSize();
@@ -58,6 +81,16 @@ void ASTAllocator::reset()
     }
 }
 
+void ASTAllocator::releaseCachedPools()
+{
+    ASSERT(m_astPools.size() == 0);
+    for (size_t i = 0; i < m_cachedPools.size(); i++) {
+        free(m_cachedPools[i]);
+    }
+    m_cachedPools.clear();
+    m_cachedPools.shrink_to_fit();
+}
+
 void* ASTAllocator::allocate(size_t size)
 {
     ASSERT(size > 0);
@@ -79,7 +112,15 @@ void ASTAllocator::allocatePool()
 
     m_astPools.push_back(currentPool());
 
-    char* pool = static_cast<char*>(malloc(astPoolSize()));
+    // reuse the pool of the same position from the previous parsing
+    char* pool;
+    size_t cacheIndex = m_astPools.size() - 1;
+    if (cacheIndex < m_cachedPools.size() && m_cachedPools[cacheIndex]) {
+        pool = static_cast<char*>(m_cachedPools[cacheIndex]);
+        m_cachedPools[cacheIndex] = nullptr;
+    } else {
+        pool = static_cast<char*>(malloc(astPoolSize()));
+    }
     m_astPoolMemory = pool;
     m_astPoolEnd = pool + astPoolSize();
 }
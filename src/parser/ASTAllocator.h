@@ -20,6 +20,11 @@
 #ifndef __EscargotASTAllocator__
 #define __EscargotASTAllocator__
 
+// max bytes of pools kept after parsing for the next one (default: second and third pool)
+#ifndef AST_ALLOCATOR_MAX_CACHED_POOL_SIZE
+#define AST_ALLOCATOR_MAX_CACHED_POOL_SIZE (1024 * 144)
+#endif
+
 namespace Escargot {
 
 class Node;
@@ -40,18 +45,43 @@ public:
         return (m_astPoolMemory == currentPool());
     }
 
+    // free the pools kept for the next parsing
+    void releaseCachedPools();
+
+    // largest amount of pool memory used by a single parsing since the last call
+    size_t takePeakPoolSize()
+    {
+        size_t peak = m_peakPoolSize;
+        m_peakPoolSize = 0;
+        return peak;
+    }
+
 private:
     inline size_t astPoolSize() const
+    {
+        return astPoolSizeAt(m_astPools.size());
+    }
+
+    inline size_t usedPoolSize() const
+    {
+        size_t size = 0;
+        for (size_t i = 0; i <= m_astPools.size(); i++) {
+            size += astPoolSizeAt(i);
+        }
+        return size;
+    }
+
+    static size_t astPoolSizeAt(size_t index)
     {
         const size_t astPoolSizeMap[] = {
             1024 * 4,
             1024 * 16,
             1024 * 128
         };
-        if (m_astPools.size() >= (sizeof(astPoolSizeMap) / sizeof(size_t))) {
+        if (index >= (sizeof(astPoolSizeMap) / sizeof(size_t))) {
             return astPoolSizeMap[(sizeof(astPoolSizeMap) / sizeof(size_t)) - 1];
         }
-        return astPoolSizeMap[m_astPools.size()];
+        return astPoolSizeMap[index];
     }
 
     size_t alignSize(size_t size)
@@ -71,6 +101,9 @@ private:
     char* m_astPoolEnd;
 
     std::vector<void*> m_astPools;
+    // pools released by the last reset, m_cachedPools[i] has the size of the (i + 1)th pool
+    std::vector<void*> m_cachedPools;
+    size_t m_peakPoolSize;
 };
 } // namespace Escargot
 #endif
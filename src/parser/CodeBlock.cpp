@@ -295,6 +295,7 @@ InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script)
     , m_allowSuperProperty(false)
     , m_allowArguments(false)
     , m_hasDynamicSourceCode(false)
+    , m_isByteCodeBlockPruned(false)
 #if defined(ENABLE_TCO)
     , m_isTailRecursionDisabled(false)
 #endif
@@ -887,6 +888,8 @@ InterpretedCodeBlock::IndexedIdentifierInfo InterpretedCodeBlock::indexedIdentif
                         info.m_isGlobalLexicalVariable = true;
                     } else {
                         info.m_isGlobalLexicalVariable = false;
+                        // module top-level bindings are stored on ModuleEnvironmentRecord (block is not allocated)
+                        info.m_isInBlockEnvironment = !info.m_isStackAllocated && bi->shouldAllocateEnvironment();
                         ASSERT(info.m_index != SIZE_MAX);
                     }
                     return info;
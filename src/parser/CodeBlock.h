@@ -219,6 +219,9 @@ public:
         bool m_isStackAllocated : 1;
         bool m_isMutable : 1;
         bool m_isGlobalLexicalVariable : 1;
+        // true if the variable is stored in a heap-allocated block environment.
+        // the record of that environment is always DeclarativeEnvironmentRecordIndexed
+        bool m_isInBlockEnvironment : 1;
         enum DeclarationType ENSURE_ENUM_UNSIGNED {
             VarDeclared,
             LexicallyDeclared,
@@ -236,6 +239,7 @@ public:
             , m_isStackAllocated(false)
             , m_isMutable(false)
             , m_isGlobalLexicalVariable(false)
+            , m_isInBlockEnvironment(false)
             , m_type(VarDeclared)
             , m_blockIndex(LEXICAL_BLOCK_INDEX_MAX)
             , m_upperIndex(SIZE_MAX)
@@ -496,6 +500,16 @@ public:
         m_byteCodeBlock = block;
     }
 
+    bool isByteCodeBlockPruned() const
+    {
+        return m_isByteCodeBlockPruned;
+    }
+
+    void setByteCodeBlockPruned(bool pruned)
+    {
+        m_isByteCodeBlockPruned = pruned;
+    }
+
     InterpretedCodeBlock* parent()
     {
         return m_parent;
@@ -1025,6 +1039,8 @@ protected:
     bool m_allowArguments : 1;
     // represent if its source code is created dynamically by createDynamicFunctionScript
     bool m_hasDynamicSourceCode : 1;
+    // set when ByteCodeBlock of this CodeBlock is pruned by VMInstance (cleared after regeneration)
+    bool m_isByteCodeBlockPruned : 1;
 #if defined(ENABLE_TCO)
     bool m_isTailRecursionDisabled : 1;
 #endif
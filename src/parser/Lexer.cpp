@@ -26,6 +26,14 @@
 #include "double-conversion.h"
 #include "ieee.h"
 
+#if (defined(COMPILER_GCC) || defined(COMPILER_CLANG)) && defined(__SSE2__)
+#include <emmintrin.h>
+#define ESCARGOT_LEXER_USE_SSE2
+#elif (defined(COMPILER_GCC) || defined(COMPILER_CLANG)) && defined(CPU_ARM64) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define ESCARGOT_LEXER_USE_NEON
+#endif
+
 using namespace Escargot::EscargotLexer;
 
 namespace Escargot {
@@ -260,6 +268,184 @@ static ALWAYS_INLINE bool isIdentifierStart(char32_t ch)
     return isIdentifierPartSlow(ch) || isIdentifierPartSlowSupplementary(ch);
 }
 
+// Vector helpers used by the scanning fast paths below.
+// firstSetLane reports the first lane whose comparison result is all ones.
+template <typename CharType>
+struct LexerVector;
+
+#if defined(ESCARGOT_LEXER_USE_SSE2)
+template <>
+struct LexerVector<LChar> {
+    typedef __m128i Type;
+    static const size_t lanes = 16;
+
+    static ALWAYS_INLINE Type load(const LChar* src) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+    static ALWAYS_INLINE Type splat(char16_t ch) { return _mm_set1_epi8(static_cast<char>(ch)); }
+    static ALWAYS_INLINE Type equal(Type a, Type b) { return _mm_cmpeq_epi8(a, b); }
+    // signed comparison is fine here because bounds are ASCII and non-ASCII bytes are negative
+    static ALWAYS_INLINE Type inRange(Type v, char lo, char hi) { return _mm_and_si128(_mm_cmpgt_epi8(v, splat(lo - 1)), _mm_cmplt_epi8(v, splat(hi + 1))); }
+    static ALWAYS_INLINE Type bitOr(Type a, Type b) { return _mm_or_si128(a, b); }
+    static ALWAYS_INLINE Type bitNot(Type a) { return _mm_xor_si128(a, _mm_set1_epi8(-1)); }
+    static ALWAYS_INLINE Type unicodeLineTerminator(Type) { return _mm_setzero_si128(); }
+    static ALWAYS_INLINE bool firstSetLane(Type m, size_t& lane)
+    {
+        unsigned bits = _mm_movemask_epi8(m);
+        if (bits) {
+            lane = __builtin_ctz(bits);
+            return true;
+        }
+        return false;
+    }
+};
+
+template <>
+struct LexerVector<char16_t> {
+    typedef __m128i Type;
+    static const size_t lanes = 8;
+
+    static ALWAYS_INLINE Type load(const char16_t* src) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+    static ALWAYS_INLINE Type splat(char16_t ch) { return _mm_set1_epi16(static_cast<short>(ch)); }
+    static ALWAYS_INLINE Type equal(Type a, Type b) { return _mm_cmpeq_epi16(a, b); }
+    static ALWAYS_INLINE Type inRange(Type v, char lo, char hi) { return _mm_and_si128(_mm_cmpgt_epi16(v, splat(lo - 1)), _mm_cmplt_epi16(v, splat(hi + 1))); }
+    static ALWAYS_INLINE Type bitOr(Type a, Type b) { return _mm_or_si128(a, b); }
+    static ALWAYS_INLINE Type bitNot(Type a) { return _mm_xor_si128(a, _mm_set1_epi8(-1)); }
+    // U+2028 and U+2029 differ only in the lowest bit
+    static ALWAYS_INLINE Type unicodeLineTerminator(Type v) { return equal(_mm_and_si128(v, splat(0xFFFE)), splat(0x2028)); }
+    static ALWAYS_INLINE bool firstSetLane(Type m, size_t& lane)
+    {
+        unsigned bits = _mm_movemask_epi8(m);
+        if (bits) {
+            lane = __builtin_ctz(bits) >> 1;
+            return true;
+        }
+        return false;
+    }
+};
+#elif defined(ESCARGOT_LEXER_USE_NEON)
+template <>
+struct LexerVector<LChar> {
+    typedef uint8x16_t Type;
+    static const size_t lanes = 16;
+
+    static ALWAYS_INLINE Type load(const LChar* src) { return vld1q_u8(src); }
+    static ALWAYS_INLINE Type splat(char16_t ch) { return vdupq_n_u8(static_cast<uint8_t>(ch)); }
+    static ALWAYS_INLINE Type equal(Type a, Type b) { return vceqq_u8(a, b); }
+    static ALWAYS_INLINE Type inRange(Type v, char lo, char hi) { return vandq_u8(vcgeq_u8(v, splat(lo)), vcleq_u8(v, splat(hi))); }
+    static ALWAYS_INLINE Type bitOr(Type a, Type b) { return vorrq_u8(a, b); }
+    static ALWAYS_INLINE Type bitNot(Type a) { return vmvnq_u8(a); }
+    static ALWAYS_INLINE Type unicodeLineTerminator(Type) { return vdupq_n_u8(0); }
+    static ALWAYS_INLINE bool firstSetLane(Type m, size_t& lane)
+    {
+        // narrow each byte of the mask to 4 bits
+        uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (bits) {
+            lane = __builtin_ctzll(bits) >> 2;
+            return true;
+        }
+        return false;
+    }
+};
+
+template <>
+struct LexerVector<char16_t> {
+    typedef uint16x8_t Type;
+    static const size_t lanes = 8;
+
+    static ALWAYS_INLINE Type load(const char16_t* src) { return vld1q_u16(reinterpret_cast<const uint16_t*>(src)); }
+    static ALWAYS_INLINE Type splat(char16_t ch) { return vdupq_n_u16(ch); }
+    static ALWAYS_INLINE Type equal(Type a, Type b) { return vceqq_u16(a, b); }
+    static ALWAYS_INLINE Type inRange(Type v, char lo, char hi) { return vandq_u16(vcgeq_u16(v, splat(lo)), vcleq_u16(v, splat(hi))); }
+    static ALWAYS_INLINE Type bitOr(Type a, Type b) { return vorrq_u16(a, b); }
+    static ALWAYS_INLINE Type bitNot(Type a) { return vmvnq_u16(a); }
+    static ALWAYS_INLINE Type unicodeLineTerminator(Type v) { return equal(vandq_u16(v, splat(0xFFFE)), splat(0x2028)); }
+    static ALWAYS_INLINE bool firstSetLane(Type m, size_t& lane)
+    {
+        uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(m)), 0);
+        if (bits) {
+            lane = __builtin_ctzll(bits) >> 3;
+            return true;
+        }
+        return false;
+    }
+};
+#endif
+
+// Returns the index of the first character in [idx, end) which is one of a, b, c or d
+// (or U+2028 / U+2029 when requested), or end if there is none.
+template <bool matchUnicodeLineTerminators, typename CharType>
+static ALWAYS_INLINE size_t findFirstOf(const CharType* src, size_t idx, size_t end, char a, char b, char c, char d)
+{
+#if defined(ESCARGOT_LEXER_USE_SSE2) || defined(ESCARGOT_LEXER_USE_NEON)
+    typedef LexerVector<CharType> Vector;
+    const typename Vector::Type va = Vector::splat(a);
+    const typename Vector::Type vb = Vector::splat(b);
+    const typename Vector::Type vc = Vector::splat(c);
+    const typename Vector::Type vd = Vector::splat(d);
+    size_t lane;
+    for (; idx + Vector::lanes <= end; idx += Vector::lanes) {
+        typename Vector::Type v = Vector::load(src + idx);
+        typename Vector::Type m = Vector::bitOr(Vector::bitOr(Vector::equal(v, va), Vector::equal(v, vb)), Vector::bitOr(Vector::equal(v, vc), Vector::equal(v, vd)));
+        if (matchUnicodeLineTerminators) {
+            m = Vector::bitOr(m, Vector::unicodeLineTerminator(v));
+        }
+        if (Vector::firstSetLane(m, lane)) {
+            return idx + lane;
+        }
+    }
+#endif
+    for (; idx < end; idx++) {
+        char16_t ch = src[idx];
+        if (ch == a || ch == b || ch == c || ch == d || (matchUnicodeLineTerminators && (ch == 0x2028 || ch == 0x2029))) {
+            return idx;
+        }
+    }
+    return end;
+}
+
+template <bool matchUnicodeLineTerminators>
+static ALWAYS_INLINE size_t findFirstOf(const StringBufferAccessData& data, size_t idx, size_t end, char a, char b, char c, char d)
+{
+    if (data.has8BitContent) {
+        return findFirstOf<matchUnicodeLineTerminators>(reinterpret_cast<const LChar*>(data.bufferAs8Bit), idx, end, a, b, c, d);
+    }
+    return findFirstOf<matchUnicodeLineTerminators>(data.bufferAs16Bit, idx, end, a, b, c, d);
+}
+
+// Skips a run of [A-Za-z0-9_$] characters and returns the index of the first other character.
+template <typename CharType>
+static ALWAYS_INLINE size_t skipASCIIIdentifierPart(const CharType* src, size_t idx, size_t end)
+{
+#if defined(ESCARGOT_LEXER_USE_SSE2) || defined(ESCARGOT_LEXER_USE_NEON)
+    typedef LexerVector<CharType> Vector;
+    size_t lane;
+    for (; idx + Vector::lanes <= end; idx += Vector::lanes) {
+        typename Vector::Type v = Vector::load(src + idx);
+        typename Vector::Type alpha = Vector::inRange(Vector::bitOr(v, Vector::splat(0x20)), 'a', 'z');
+        typename Vector::Type ident = Vector::bitOr(Vector::bitOr(alpha, Vector::inRange(v, '0', '9')),
+                                                    Vector::bitOr(Vector::equal(v, Vector::splat('_')), Vector::equal(v, Vector::splat('$'))));
+        if (Vector::firstSetLane(Vector::bitNot(ident), lane)) {
+            return idx + lane;
+        }
+    }
+#endif
+    for (; idx < end; idx++) {
+        char16_t ch = src[idx];
+        // backslash is marked as identifier character in the table but starts an escape sequence
+        if (ch >= 128 || ch == '\\' || !(g_asciiRangeCharMap[ch] & LexerIsCharIdent)) {
+            break;
+        }
+    }
+    return idx;
+}
+
+static ALWAYS_INLINE size_t skipASCIIIdentifierPart(const StringBufferAccessData& data, size_t idx, size_t end)
+{
+    if (data.has8BitContent) {
+        return skipASCIIIdentifierPart(reinterpret_cast<const LChar*>(data.bufferAs8Bit), idx, end);
+    }
+    return skipASCIIIdentifierPart(data.bufferAs16Bit, idx, end);
+}
+
 static ALWAYS_INLINE bool isDecimalDigit(char16_t ch)
 {
     return (ch >= '0' && ch <= '9');
@@ -749,6 +935,11 @@ void Scanner::throwUnexpectedToken(const char* message)
 void Scanner::skipSingleLine()
 {
     while (!this->eof()) {
+        this->index = findFirstOf<true>(this->sourceCodeAccessData, this->index, this->length, '\n', '\r', '\n', '\r');
+        if (UNLIKELY(this->eof())) {
+            break;
+        }
+
         char16_t ch = this->peekCharWithoutEOF();
         ++this->index;
 
@@ -766,6 +957,11 @@ void Scanner::skipSingleLine()
 void Scanner::skipSingleLineComment(void)
 {
     while (!this->eof()) {
+        this->index = findFirstOf<true>(this->sourceCodeAccessData, this->index, this->length, '\n', '\r', '\n', '\r');
+        if (UNLIKELY(this->eof())) {
+            break;
+        }
+
         char16_t ch = this->peekCharWithoutEOF();
         ++this->index;
 
@@ -784,6 +980,11 @@ void Scanner::skipSingleLineComment(void)
 void Scanner::skipMultiLineComment(void)
 {
     while (!this->eof()) {
+        this->index = findFirstOf<true>(this->sourceCodeAccessData, this->index, this->length, '*', '\n', '\r', '*');
+        if (UNLIKELY(this->eof())) {
+            break;
+        }
+
         char16_t ch = this->peekCharWithoutEOF();
         ++this->index;
 
@@ -851,6 +1052,11 @@ Scanner::ScanIDResult Scanner::getIdentifier()
     const size_t start = this->index;
     ++this->index;
     while (UNLIKELY(!this->eof())) {
+        this->index = skipASCIIIdentifierPart(this->sourceCodeAccessData, this->index, this->length);
+        if (this->eof()) {
+            break;
+        }
+
         const char16_t ch = this->peekCharWithoutEOF();
         if (UNLIKELY(ch == 0x5C)) {
             // Blackslash (U+005C) marks Unicode escape sequence.
@@ -1571,6 +1777,12 @@ void Scanner::scanStringLiteral(Scanner::ScannerResult* token)
     bool isPlainCase = true;
 
     while (LIKELY(!this->eof())) {
+        // skip the plain part of the literal at once
+        this->index = findFirstOf<false>(this->sourceCodeAccessData, this->index, this->length, static_cast<char>(quote), '\\', '\n', '\r');
+        if (UNLIKELY(this->eof())) {
+            break;
+        }
+
         char16_t ch = this->peekCharWithoutEOF();
         ++this->index;
         if (ch == quote) {
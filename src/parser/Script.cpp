@@ -35,6 +35,9 @@
 #include "runtime/ScriptAsyncFunctionObject.h"
 #include "runtime/ModuleNamespaceObject.h"
 #include "parser/ast/AST.h"
+#if defined(ENABLE_CODE_CACHE)
+#include "codecache/CodeCache.h"
+#endif
 
 namespace Escargot {
 
@@ -54,6 +57,16 @@ void* Script::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+#if defined(ENABLE_CODE_CACHE)
+size_t Script::sourceCodeHashValue()
+{
+    if (UNLIKELY(m_sourceCodeHashValue == 0)) {
+        m_sourceCodeHashValue = CodeCache::computeSourceHash(m_sourceCode);
+    }
+    return m_sourceCodeHashValue;
+}
+#endif
+
 bool Script::isExecuted()
 {
     if (isModule()) {
@@ -62,6 +75,62 @@ bool Script::isExecuted()
     return m_topCodeBlock->byteCodeBlock() == nullptr;
 }
 
+size_t Script::precompileFunctions(ExecutionState& state, size_t maxByteCodeSize)
+{
+#ifdef ESCARGOT_DEBUGGER
+    // every function is already compiled on parsing time in debugging mode
+    if (context()->debuggerEnabled()) {
+        return 0;
+    }
+#endif /* ESCARGOT_DEBUGGER */
+
+    if (!m_topCodeBlock || !m_topCodeBlock->hasChildren()) {
+        return 0;
+    }
+
+    VMInstance* vmInstance = context()->vmInstance();
+    auto& currentCodeSizeTotal = vmInstance->compiledByteCodeSize();
+    size_t compiledCount = 0;
+    size_t compiledSize = 0;
+
+    // visit functions in source order
+    std::vector<InterpretedCodeBlock*> worklist;
+    auto pushChildren = [&worklist](InterpretedCodeBlock* codeBlock) {
+        InterpretedCodeBlockVector& children = codeBlock->children();
+        for (size_t i = children.size(); i > 0; i--) {
+            worklist.push_back(children[i - 1]);
+        }
+    };
+    pushChildren(m_topCodeBlock);
+
+    while (!worklist.empty() && compiledSize < maxByteCodeSize) {
+        // stop before bytecode pruning is triggered by us
+        ASSERT(currentCodeSizeTotal < std::numeric_limits<size_t>::max());
+        if (currentCodeSizeTotal >= vmInstance->maxCompiledByteCodeSize()) {
+            break;
+        }
+
+        InterpretedCodeBlock* codeBlock = worklist.back();
+        worklist.pop_back();
+        if (codeBlock->hasChildren()) {
+            pushChildren(codeBlock);
+        }
+
+        if (codeBlock->byteCodeBlock()) {
+            continue;
+        }
+
+        // same path with lazy compilation. function objects created after this use simple call path if possible
+        // error of generation is thrown to the caller
+        ScriptFunctionObject::generateByteCode(state, codeBlock);
+
+        compiledSize += codeBlock->byteCodeBlock()->memoryAllocatedSize();
+        compiledCount++;
+    }
+
+    return compiledCount;
+}
+
 bool Script::wasThereErrorOnModuleEvaluation()
 {
     return m_moduleData && m_moduleData->m_evaluationError.hasValue();
@@ -346,6 +415,8 @@ static void testDeclareGlobalFunctions(ExecutionState& state, InterpretedCodeBlo
 
 Value Script::execute(ExecutionState& state, bool isExecuteOnEvalFunction, bool inStrictMode)
 {
+    state.context()->vmInstance()->checkHeapLimit(state);
+
     if (UNLIKELY(isExecuted())) {
         if (!m_canExecuteAgain) {
             ESCARGOT_LOG_ERROR("You cannot re-execute this type of Script object");
@@ -216,13 +216,7 @@ public:
     }
 
 #if defined(ENABLE_CODE_CACHE)
-    size_t sourceCodeHashValue()
-    {
-        if (UNLIKELY(m_sourceCodeHashValue == 0)) {
-            m_sourceCodeHashValue = m_sourceCode->hashValue<0, false>();
-        }
-        return m_sourceCodeHashValue;
-    }
+    size_t sourceCodeHashValue();
 #endif
 
     size_t moduleRequestsLength();
@@ -232,6 +226,9 @@ public:
     Value moduleEvaluate(ExecutionState& state);
 
     bool isExecuted();
+    // compile ByteCodeBlock of functions in this script before their first call (in source order)
+    // returns the number of compiled functions. an error while generating bytecode is thrown to the caller
+    size_t precompileFunctions(ExecutionState& state, size_t maxByteCodeSize);
     bool wasThereErrorOnModuleEvaluation();
     Value moduleEvaluationError();
 
@@ -329,7 +329,7 @@ ScriptParser::InitializeScriptResult ScriptParser::initializeScript(String* orig
     if (cacheable) {
         ASSERT(!parentCodeBlock);
         // set m_functionIndex as SIZE_MAX for global code
-        cacheIndex = CodeCacheIndex(source->hashValue<0, false>(), source->length(), SIZE_MAX);
+        cacheIndex = CodeCacheIndex(CodeCache::computeSourceHash(source), source->length(), SIZE_MAX);
         auto result = codeCache->searchCache(cacheIndex);
         if (result.first) {
             GC_disable();
@@ -376,6 +376,7 @@ ScriptParser::InitializeScriptResult ScriptParser::initializeScript(String* orig
     Script* script = nullptr;
 
     // Parsing
+    uint64_t parseStartTime = longTickCount();
     try {
         ASTClassInfo* outerClassInfo = esprima::generateClassInfoFrom(m_context, parentCodeBlock);
 
@@ -405,6 +406,9 @@ ScriptParser::InitializeScriptResult ScriptParser::initializeScript(String* orig
         }
 
         generateCodeBlockTreeFromASTWalkerPostProcess(topCodeBlock);
+
+        m_parseStatistics.m_programParseTime += longTickCount() - parseStartTime;
+        m_parseStatistics.m_programParseCount++;
     } catch (esprima::Error* orgError) {
         // reset ASTAllocator
         m_context->astAllocator().reset();
@@ -507,8 +511,12 @@ void ScriptParser::generateFunctionByteCode(ExecutionState& state, InterpretedCo
     FunctionNode* functionNode;
 
     // Parsing
+    uint64_t parseStartTime = longTickCount();
     try {
         functionNode = esprima::parseSingleFunction(m_context, codeBlock);
+
+        m_parseStatistics.m_functionParseTime += longTickCount() - parseStartTime;
+        m_parseStatistics.m_functionParseCount++;
     } catch (esprima::Error* orgError) {
         // reset ASTAllocator
         m_context->astAllocator().reset();
@@ -63,6 +63,29 @@ public:
 
     void generateFunctionByteCode(ExecutionState& state, InterpretedCodeBlock* codeBlock);
 
+    // accumulated time (in microseconds) spent in parsing of both phases
+    // program: the first pass over an entire script
+    // function: the reparsing of each function body on its first call
+    struct ParseStatistics {
+        uint64_t m_programParseTime;
+        size_t m_programParseCount;
+        uint64_t m_functionParseTime;
+        size_t m_functionParseCount;
+
+        ParseStatistics()
+            : m_programParseTime(0)
+            , m_programParseCount(0)
+            , m_functionParseTime(0)
+            , m_functionParseCount(0)
+        {
+        }
+    };
+
+    const ParseStatistics& parseStatistics() const
+    {
+        return m_parseStatistics;
+    }
+
 #if defined(ENABLE_CODE_CACHE)
     void setCodeBlockCacheInfo(CodeBlockCacheInfo* info);
     void deleteCodeBlockCacheInfo();
@@ -82,6 +105,7 @@ private:
 #endif /* ESCARGOT_DEBUGGER */
 
     Context* m_context;
+    ParseStatistics m_parseStatistics;
 
 #if defined(ENABLE_CODE_CACHE)
     CodeBlockCacheInfo* m_codeBlockCacheInfo;
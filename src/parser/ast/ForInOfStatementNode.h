@@ -269,17 +269,30 @@ public:
             ASSERT(newContext.m_registerStack->size() == baseCountBefore);
             continuePosition = codeBlock->currentCodeSize();
 
-            // Let nextResult be ? Call(iteratorRecord.[[NextMethod]], iteratorRecord.[[Iterator]], « »).
-            IteratorOperation::IteratorNextData iteratorNextData;
-            iteratorNextData.m_iteratorRecordRegisterIndex = REGISTER_LIMIT;
-            iteratorNextData.m_valueRegisterIndex = REGISTER_LIMIT;
-            iteratorNextData.m_returnRegisterIndex = newContext.getRegister();
-
             size_t iteratorNextOperationPos = codeBlock->currentCodeSize();
-            codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorNextData), &newContext, this->m_loc.index);
-
-            // If iteratorKind is async, then set nextResult to ? Await(nextResult).
-            if (m_isForAwaitOf) {
+            if (!m_isForAwaitOf) {
+                // nextResult of sync for-of never escapes the loop head
+                // so we use fused IteratorStepValue operation which can skip allocating {value, done} object
+                IteratorOperation::IteratorStepValueData iteratorStepValueData;
+                iteratorStepValueData.m_iteratorRecordRegisterIndex = REGISTER_LIMIT;
+                iteratorStepValueData.m_dstRegisterIndex = newContext.getRegister();
+                size_t doneRegister = newContext.getRegister();
+                iteratorStepValueData.m_doneRegisterIndex = doneRegister;
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorStepValueData), &newContext, this->m_loc.index);
+
+                // If done is true, return NormalCompletion(V).
+                codeBlock->pushCode(JumpIfTrue(ByteCodeLOC(m_loc.index), doneRegister), &newContext, this->m_loc.index);
+                exit2Pos = codeBlock->lastCodePosition<JumpIfTrue>();
+                newContext.giveUpRegister(); // drop doneRegister
+            } else {
+                // Let nextResult be ? Call(iteratorRecord.[[NextMethod]], iteratorRecord.[[Iterator]], « »).
+                IteratorOperation::IteratorNextData iteratorNextData;
+                iteratorNextData.m_iteratorRecordRegisterIndex = REGISTER_LIMIT;
+                iteratorNextData.m_valueRegisterIndex = REGISTER_LIMIT;
+                iteratorNextData.m_returnRegisterIndex = newContext.getRegister();
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorNextData), &newContext, this->m_loc.index);
+
+                // If iteratorKind is async, then set nextResult to ? Await(nextResult).
                 size_t tailDataLength = newContext.m_recursiveStatementStack.size() * (sizeof(ByteCodeGenerateContext::RecursiveStatementKind) + sizeof(size_t));
                 ExecutionPause::ExecutionPauseAwaitData data;
                 data.m_awaitIndex = iteratorNextData.m_returnRegisterIndex;
@@ -287,30 +300,31 @@ public:
                 data.m_dstStateIndex = REGISTER_LIMIT;
                 data.m_tailDataLength = tailDataLength;
                 codeBlock->pushCode(ExecutionPause(ByteCodeLOC(m_loc.index), data), &newContext, this->m_loc.index);
+
+                // If Type(nextResult) is not Object, throw a TypeError exception.
+                IteratorOperation::IteratorTestResultIsObjectData iteratorTestResultIsObjectData;
+                iteratorTestResultIsObjectData.m_valueRegisterIndex = iteratorNextData.m_returnRegisterIndex;
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorTestResultIsObjectData), &newContext, this->m_loc.index);
+
+                // Let done be ? IteratorComplete(nextResult).
+                size_t doneRegister = newContext.getRegister();
+                IteratorOperation::IteratorTestDoneData iteratorTestDoneData;
+                iteratorTestDoneData.m_iteratorRecordOrObjectRegisterIndex = iteratorNextData.m_returnRegisterIndex;
+                iteratorTestDoneData.m_dstRegisterIndex = doneRegister;
+                iteratorTestDoneData.m_isIteratorRecord = false;
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorTestDoneData), &newContext, this->m_loc.index);
+
+                // If done is true, return NormalCompletion(V).
+                codeBlock->pushCode(JumpIfTrue(ByteCodeLOC(m_loc.index), doneRegister), &newContext, this->m_loc.index);
+                exit2Pos = codeBlock->lastCodePosition<JumpIfTrue>();
+                newContext.giveUpRegister(); // drop doneRegister
+
+                // Let nextValue be ? IteratorValue(nextResult).
+                IteratorOperation::IteratorValueData iteratorValueData;
+                iteratorValueData.m_srcRegisterIndex = iteratorNextData.m_returnRegisterIndex;
+                iteratorValueData.m_dstRegisterIndex = iteratorNextData.m_returnRegisterIndex;
+                codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorValueData), &newContext, this->m_loc.index);
             }
-            // If Type(nextResult) is not Object, throw a TypeError exception.
-            IteratorOperation::IteratorTestResultIsObjectData iteratorTestResultIsObjectData;
-            iteratorTestResultIsObjectData.m_valueRegisterIndex = iteratorNextData.m_returnRegisterIndex;
-            codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorTestResultIsObjectData), &newContext, this->m_loc.index);
-
-            // Let done be ? IteratorComplete(nextResult).
-            size_t doneRegister = newContext.getRegister();
-            IteratorOperation::IteratorTestDoneData iteratorTestDoneData;
-            iteratorTestDoneData.m_iteratorRecordOrObjectRegisterIndex = iteratorNextData.m_returnRegisterIndex;
-            iteratorTestDoneData.m_dstRegisterIndex = doneRegister;
-            iteratorTestDoneData.m_isIteratorRecord = false;
-            codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorTestDoneData), &newContext, this->m_loc.index);
-
-            // If done is true, return NormalCompletion(V).
-            codeBlock->pushCode(JumpIfTrue(ByteCodeLOC(m_loc.index), doneRegister), &newContext, this->m_loc.index);
-            exit2Pos = codeBlock->lastCodePosition<JumpIfTrue>();
-            newContext.giveUpRegister(); // drop doneRegister
-
-            // Let nextValue be ? IteratorValue(nextResult).
-            IteratorOperation::IteratorValueData iteratorValueData;
-            iteratorValueData.m_srcRegisterIndex = iteratorNextData.m_returnRegisterIndex;
-            iteratorValueData.m_dstRegisterIndex = iteratorNextData.m_returnRegisterIndex;
-            codeBlock->pushCode(IteratorOperation(ByteCodeLOC(m_loc.index), iteratorValueData), &newContext, this->m_loc.index);
 
             forOfEndCheckRegisterHeadEndPosition = codeBlock->currentCodeSize();
             codeBlock->pushCode(LoadLiteral(ByteCodeLOC(m_loc.index), SIZE_MAX, Value(false)), &newContext, this->m_loc.index);
@@ -344,7 +358,11 @@ public:
 
             codeBlock->peekCode<IteratorOperation>(getIteratorOperationPosition)->m_getIteratorData.m_dstIteratorRecordIndex = iteratorRecordRegisterIndex;
             codeBlock->peekCode<IteratorOperation>(getIteratorOperationPosition)->m_getIteratorData.m_dstIteratorObjectIndex = iteratorObjectRegisterIndex;
-            codeBlock->peekCode<IteratorOperation>(iteratorNextOperationPos)->m_iteratorNextData.m_iteratorRecordRegisterIndex = iteratorRecordRegisterIndex;
+            if (!m_isForAwaitOf) {
+                codeBlock->peekCode<IteratorOperation>(iteratorNextOperationPos)->m_iteratorStepValueData.m_iteratorRecordRegisterIndex = iteratorRecordRegisterIndex;
+            } else {
+                codeBlock->peekCode<IteratorOperation>(iteratorNextOperationPos)->m_iteratorNextData.m_iteratorRecordRegisterIndex = iteratorRecordRegisterIndex;
+            }
         }
 
         size_t blockExitPos = codeBlock->currentCodeSize();
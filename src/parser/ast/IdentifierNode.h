@@ -161,7 +161,11 @@ public:
                             ASSERT(m_name == codeBlock->codeBlock()->functionName() && codeBlock->codeBlock()->isFunctionExpression() && codeBlock->codeBlock()->isFunctionNameSaveOnHeap());
                         }
 
-                        codeBlock->pushCode(StoreByHeapIndex(ByteCodeLOC(m_loc.index), srcRegister, info.m_upperIndex, info.m_index), context, this->m_loc.index);
+                        if (info.m_isInBlockEnvironment) {
+                            codeBlock->pushCode(StoreByBlockHeapIndex(ByteCodeLOC(m_loc.index), srcRegister, info.m_upperIndex, info.m_index), context, this->m_loc.index);
+                        } else {
+                            codeBlock->pushCode(StoreByHeapIndex(ByteCodeLOC(m_loc.index), srcRegister, info.m_upperIndex, info.m_index), context, this->m_loc.index);
+                        }
                     }
                 }
             }
@@ -224,7 +228,11 @@ public:
                         ASSERT(context->m_codeBlock->context()->staticStrings().undefined != m_name);
                         codeBlock->pushCode(GetGlobalVariable(ByteCodeLOC(m_loc.index), dstRegister, codeBlock->m_codeBlock->context()->ensureGlobalVariableAccessCacheSlot(m_name)), context, this->m_loc.index);
                     } else {
-                        codeBlock->pushCode(LoadByHeapIndex(ByteCodeLOC(m_loc.index), dstRegister, info.m_upperIndex, info.m_index), context, this->m_loc.index);
+                        if (info.m_isInBlockEnvironment) {
+                            codeBlock->pushCode(LoadByBlockHeapIndex(ByteCodeLOC(m_loc.index), dstRegister, info.m_upperIndex, info.m_index), context, this->m_loc.index);
+                        } else {
+                            codeBlock->pushCode(LoadByHeapIndex(ByteCodeLOC(m_loc.index), dstRegister, info.m_upperIndex, info.m_index), context, this->m_loc.index);
+                        }
                     }
                 }
             }
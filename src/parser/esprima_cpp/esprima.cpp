@@ -531,6 +531,41 @@ public:
         return true;
     }
 
+    bool isNextChildArrowFunctionAt(size_t index)
+    {
+        ASSERT(this->isParsingSingleFunction);
+        InterpretedCodeBlock* currentTarget = this->codeBlock;
+        if (!currentTarget->hasChildren() || this->subCodeBlockIndex >= currentTarget->children().size()) {
+            return false;
+        }
+
+        InterpretedCodeBlock* childBlock = currentTarget->childBlockAt(this->subCodeBlockIndex);
+        return childBlock->isArrowFunctionExpression() && !childBlock->isOneExpressionOnlyVirtualArrowFunctionExpression()
+            && !childBlock->isFunctionBodyOnlyVirtualArrowFunctionExpression()
+            && childBlock->functionStart().index - currentTarget->functionStart().index == index;
+    }
+
+    // skip an arrow function whose first token is the current lookahead
+    void skipArrowFunction()
+    {
+        ASSERT(this->isParsingSingleFunction);
+        InterpretedCodeBlock* currentTarget = this->codeBlock;
+
+        InterpretedCodeBlock* childBlock = currentTarget->childBlockAt(this->subCodeBlockIndex);
+        this->scanner->index = childBlock->src().length() + childBlock->functionStart().index - currentTarget->functionStart().index;
+        this->scanner->lineNumber = childBlock->functionStart().line;
+        this->scanner->lineStart = childBlock->functionStart().index - childBlock->functionStart().column;
+
+        this->lookahead.lineNumber = this->scanner->lineNumber;
+        this->lookahead.lineStart = this->scanner->lineStart;
+        this->nextToken();
+
+        this->context->firstCoverInitializedNameError.reset();
+
+        // increase subCodeBlockIndex because parsing of an internal function is skipped
+        this->subCodeBlockIndex++;
+    }
+
     void throwError(const char* messageFormat, String* arg0 = String::emptyString(), String* arg1 = String::emptyString(), ErrorCode code = ErrorCode::SyntaxError)
     {
         UTF16StringDataNonGCStd msg;
@@ -3182,6 +3217,15 @@ public:
             MetaNode startNode = this->createNode();
             Marker startMarker = this->lastMarker;
 
+            // the first pass already recorded where each arrow function starts,
+            // so skip it here without parsing its parameters as a cover grammar first
+            if (this->isParsingSingleFunction && this->isNextChildArrowFunctionAt(startNode.index)) {
+                this->context->isAssignmentTarget = false;
+                this->context->isBindingElement = false;
+                this->skipArrowFunction();
+                return this->finalize(this->startNode(startToken), builder.createArrowFunctionExpressionNode(subCodeBlockIndex));
+            }
+
             bool isAsync = false;
             exprNode = this->parseConditionalExpression(builder);
 
@@ -3213,22 +3257,7 @@ public:
                     this->scanner->lineStart = startMarker.lineStart;
                     this->nextToken();
 
-                    InterpretedCodeBlock* currentTarget = this->codeBlock;
-                    size_t orgIndex = this->lookahead.start;
-
-                    InterpretedCodeBlock* childBlock = currentTarget->childBlockAt(this->subCodeBlockIndex);
-                    this->scanner->index = childBlock->src().length() + childBlock->functionStart().index - currentTarget->functionStart().index;
-                    this->scanner->lineNumber = childBlock->functionStart().line;
-                    this->scanner->lineStart = childBlock->functionStart().index - childBlock->functionStart().column;
-
-                    this->lookahead.lineNumber = this->scanner->lineNumber;
-                    this->lookahead.lineStart = this->scanner->lineStart;
-                    this->nextToken();
-
-                    this->context->firstCoverInitializedNameError.reset();
-
-                    // increase subCodeBlockIndex because parsing of an internal function is skipped
-                    this->subCodeBlockIndex++;
+                    this->skipArrowFunction();
 
                     return this->finalize(this->startNode(startToken), builder.createArrowFunctionExpressionNode(subCodeBlockIndex));
                 }
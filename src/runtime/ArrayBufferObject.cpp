@@ -89,6 +89,7 @@ void ArrayBufferObject::allocateBuffer(ExecutionState& state, size_t byteLength)
     detachArrayBuffer();
 
     ASSERT(byteLength < ArrayBuffer::maxArrayBufferSize);
+    state.context()->vmInstance()->checkHeapLimit(state, byteLength);
 
     const size_t ratio = std::max((size_t)GC_get_free_space_divisor() / 6, (size_t)1);
     if (byteLength > (GC_get_heap_size() / ratio)) {
@@ -110,6 +111,7 @@ void ArrayBufferObject::allocateResizableBuffer(ExecutionState& state, size_t by
 
     ASSERT(byteLength <= maxByteLength);
     ASSERT(maxByteLength < ArrayBuffer::maxArrayBufferSize);
+    state.context()->vmInstance()->checkHeapLimit(state, maxByteLength);
 
     const size_t ratio = std::max((size_t)GC_get_free_space_divisor() / 6, (size_t)1);
     if (maxByteLength > (GC_get_heap_size() / ratio)) {
@@ -29,10 +29,12 @@ static void backingStorePlatformDeleter(void* data, size_t length, void* deleter
     if (!!data) {
         Global::platform()->onFreeArrayBufferObjectDataBuffer(data, length);
     }
+    ThreadLocal::decreaseArrayBufferBytes(length);
 }
 
 BackingStore* BackingStore::createDefaultNonSharedBackingStore(size_t byteLength)
 {
+    ThreadLocal::increaseArrayBufferBytes(byteLength);
     return new NonSharedBackingStore(
         Global::platform()->onMallocArrayBufferObjectDataBuffer(byteLength),
         byteLength, backingStorePlatformDeleter, nullptr, true);
@@ -41,6 +43,7 @@ BackingStore* BackingStore::createDefaultNonSharedBackingStore(size_t byteLength
 BackingStore* BackingStore::createDefaultResizableNonSharedBackingStore(size_t byteLength, size_t maxByteLength)
 {
     // Resizable BackingStore is allocated by Platform only
+    ThreadLocal::increaseArrayBufferBytes(maxByteLength);
     return new NonSharedBackingStore(
         Global::platform()->onMallocArrayBufferObjectDataBuffer(maxByteLength),
         byteLength, backingStorePlatformDeleter, maxByteLength, true);
@@ -113,12 +116,15 @@ void NonSharedBackingStore::reallocate(size_t newByteLength)
 
     if (m_isAllocatedByPlatform) {
         m_data = Global::platform()->onReallocArrayBufferObjectDataBuffer(m_data, m_byteLength, newByteLength);
+        ThreadLocal::increaseArrayBufferBytes(newByteLength);
+        ThreadLocal::decreaseArrayBufferBytes(m_byteLength);
         m_byteLength = newByteLength;
     } else {
         // Note) even if BackingStore was previously allocated by other allocator,
         // newly reallocate it with default Platform allocator
         m_deleter(m_data, m_byteLength, m_deleterData);
         m_data = Global::platform()->onMallocArrayBufferObjectDataBuffer(newByteLength);
+        ThreadLocal::increaseArrayBufferBytes(newByteLength);
         m_deleter = backingStorePlatformDeleter;
         m_deleterData = nullptr;
         m_byteLength = newByteLength;
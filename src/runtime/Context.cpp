@@ -244,6 +244,7 @@ GlobalVariableAccessCacheItem* Context::ensureGlobalVariableAccessCacheSlot(Atom
         slot->m_propertyName = as;
         slot->m_cachedAddress = nullptr;
         slot->m_cachedStructure = nullptr;
+        slot->m_isCachedPropertyReadOnly = false;
         m_globalVariableAccessCache->insert(std::make_pair(as, slot));
         return slot;
     }
@@ -67,6 +67,8 @@ struct GlobalVariableAccessCacheItem : public gc {
     AtomicString m_propertyName;
     void* m_cachedAddress;
     ObjectStructure* m_cachedStructure;
+    // non-writable data property can be cached only for reading
+    bool m_isCachedPropertyReadOnly;
 
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
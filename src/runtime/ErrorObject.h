@@ -90,6 +90,7 @@ public:
         static constexpr const char* DivisionByZero = "Division by zero";
         static constexpr const char* Overflow = "overflow occurred";
         static constexpr const char* OutOfMemory = "out of memory";
+        static constexpr const char* HeapLimitExceeded = "Heap limit exceeded";
         static constexpr const char* ExponentByNegative = "Exponent must be positive";
         static constexpr const char* GlobalObject_ThisUndefinedOrNull = "%s: this value is undefined or null";
         static constexpr const char* GlobalObject_ThisNotObject = "%s: this value is not an object";
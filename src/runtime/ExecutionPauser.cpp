@@ -105,6 +105,15 @@ Value ExecutionPauser::start(ExecutionState& state, ExecutionPauser* self, Objec
         ExecutionState* m_oldParent;
     };
 
+    if (UNLIKELY(self->m_byteCodeBlock == nullptr)) {
+        // released pauser (execution already finished). same as ExecutionResume, there is nothing to run
+        ASSERT(self->m_executionState == nullptr && self->m_registerFile == nullptr);
+        if (from == StartFrom::Generator) {
+            return IteratorObject::createIterResultObject(state, Value(), true);
+        }
+        return Value();
+    }
+
     ExecutionState* originalState = self->m_executionState;
     while (!originalState->pauseSource()) {
         originalState = originalState->parent();
@@ -147,6 +156,24 @@ Value ExecutionPauser::start(ExecutionState& state, ExecutionPauser* self, Objec
             // need to fresh start
             startPos = programStart;
             es = self->m_executionState;
+        } else if (self->m_pausedCode.size() == 0) {
+            // resume without resume code
+            // paused on top of function body. there is no recursive statement to restore
+            es = self->m_executionState;
+            ASSERT(self->m_executionState == originalState);
+            startPos += programStart;
+            es->m_inExecutionStopState = false;
+
+            if (self->m_resumeStateIndex == REGISTER_LIMIT) {
+                if (isAbruptThrow) {
+                    es->m_programCounter = &startPos;
+                    es->throwException(resumeValue);
+                } else if (isAbruptReturn) {
+                    // same as ExecutionResume with needsReturn. function ends with resumeValue
+                    startPos = SIZE_MAX;
+                    result = resumeValue;
+                }
+            }
         } else {
             // resume
             startPos = reinterpret_cast<size_t>(self->m_pausedCode.data());
@@ -183,7 +210,9 @@ Value ExecutionPauser::start(ExecutionState& state, ExecutionPauser* self, Objec
         }
 #endif /* ESCARGOT_DEBUGGER */
 
-        result = Interpreter::interpret(es, self->m_byteCodeBlock, startPos, self->m_registerFile);
+        if (LIKELY(startPos != SIZE_MAX)) {
+            result = Interpreter::interpret(es, self->m_byteCodeBlock, startPos, self->m_registerFile);
+        }
 
 #ifdef ESCARGOT_DEBUGGER
         if (activeSavedStackTraceExecutionState != ESCARGOT_DEBUGGER_NO_STACK_TRACE_RESTORE) {
@@ -301,9 +330,12 @@ void ExecutionPauser::pause(ExecutionState& state, Value returnValue, size_t tai
     originalState->m_programCounter = nullptr;
 
     self->m_pausedCode.clear();
+    self->m_resumeByteCodePosition = SIZE_MAX;
 
     // some case(async generator), the function execution ended before pause
-    if (self->m_byteCodeBlock) {
+    // if there is no recursive statement(block, try...) around pause point,
+    // we don't need resume code. start function resumes execution on original bytecode directly
+    if (self->m_byteCodeBlock && tailDataLength) {
         // read & fill recursive statement self
         char* start = (char*)(tailDataPosition);
         char* end = (char*)(start + tailDataLength);
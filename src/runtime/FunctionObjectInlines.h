@@ -102,6 +102,7 @@ public:
         }
 
         ByteCodeBlock* blk = codeBlock->byteCodeBlock();
+        blk->m_executionCount++;
         Context* ctx = codeBlock->context();
         bool isStrict = codeBlock->isStrict();
         const size_t registerFileSize = blk->m_requiredTotalRegisterNumber;
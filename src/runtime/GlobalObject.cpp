@@ -161,6 +161,49 @@ ObjectGetResult GlobalObject::getOwnProperty(ExecutionState& state, const Object
     return r;
 }
 
+void GlobalObject::defineLazyBuiltinMethod(ExecutionState& state, Object* target, AtomicString StaticStrings::*name, ObjectPropertyNativeGetterSetterData* nativeData)
+{
+    bool result = target->defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().*name), nativeData, Value(this));
+    ASSERT(result);
+    UNUSED_VARIABLE(result);
+}
+
+Value GlobalObject::materializeLazyBuiltinMethod(ExecutionState& state, Object* target, const EncodedValue& globalObject, AtomicString StaticStrings::*name, NativeFunctionPointer fn, size_t argc)
+{
+    // method should be created in the realm of target even if accessed from another realm
+    Context* context = Value(globalObject).asObject()->asGlobalObject()->m_context;
+    ExecutionState tempState(context);
+    Value method = new NativeFunctionObject(tempState, NativeFunctionInfo(context->staticStrings().*name, fn, argc, NativeFunctionInfo::Strict));
+
+    replaceLazyBuiltinMethod(state, target, name, method);
+    return method;
+}
+
+void GlobalObject::replaceLazyBuiltinMethod(ExecutionState& state, Object* target, AtomicString StaticStrings::*name, const Value& value)
+{
+    // convert the property into plain data property (attributes could be modified by user)
+    // so that the method can be inline cached from now on
+    auto findResult = target->structure()->findProperty(state.context()->staticStrings().*name);
+    ASSERT(findResult.first != SIZE_MAX);
+    size_t idx = findResult.first;
+    const ObjectStructurePropertyDescriptor& current = findResult.second->m_descriptor;
+    ASSERT(current.isDataProperty() && !current.isPlainDataProperty());
+
+    int attributes = ObjectStructurePropertyDescriptor::NotPresent;
+    if (current.isWritable()) {
+        attributes |= ObjectStructurePropertyDescriptor::WritablePresent;
+    }
+    if (current.isEnumerable()) {
+        attributes |= ObjectStructurePropertyDescriptor::EnumerablePresent;
+    }
+    if (current.isConfigurable()) {
+        attributes |= ObjectStructurePropertyDescriptor::ConfigurablePresent;
+    }
+
+    target->m_structure = target->m_structure->replacePropertyDescriptor(idx, ObjectStructurePropertyDescriptor::createDataDescriptor((ObjectStructurePropertyDescriptor::PresentAttribute)attributes));
+    target->m_values[idx] = value;
+}
+
 Value GlobalObject::eval(ExecutionState& state, const Value& arg)
 {
     if (arg.isString()) {
@@ -27,14 +27,16 @@
 namespace Escargot {
 
 class FunctionObject;
+class StaticStrings;
 
 #define GLOBALOBJECT_BUILTIN_ARRAYBUFFER(F, objName) \
     F(arrayBuffer, FunctionObject, objName)          \
     F(arrayBufferPrototype, Object, objName)
-#define GLOBALOBJECT_BUILTIN_ARRAY(F, objName) \
-    F(array, FunctionObject, objName)          \
-    F(arrayPrototype, Object, objName)         \
-    F(arrayIteratorPrototype, Object, objName) \
+#define GLOBALOBJECT_BUILTIN_ARRAY(F, objName)             \
+    F(array, FunctionObject, objName)                      \
+    F(arrayPrototype, Object, objName)                     \
+    F(arrayIteratorPrototype, Object, objName)             \
+    F(arrayIteratorPrototypeNext, FunctionObject, objName) \
     F(arrayPrototypeValues, FunctionObject, objName)
 #define GLOBALOBJECT_BUILTIN_ASYNCFROMSYNCITERATOR(F, objName) \
     F(asyncFromSyncIteratorPrototype, Object, objName)
@@ -406,7 +408,43 @@ private:
 
     template <typename TA, int elementSize>
     FunctionObject* installTypedArray(ExecutionState& state, AtomicString taName, Object** proto, FunctionObject* typedArrayFunction);
+
+    /*
+       Lazy builtin method
+       NativeFunctionObject of method is created on first access of the property instead of install#objName
+       Until then, ObjectStructure only refers static native getter/setter data of the method
+       and its property slot holds GlobalObject of the method
+    */
+    template <AtomicString StaticStrings::*name, NativeFunctionPointer fn, size_t argc>
+    struct LazyBuiltinMethod {
+        static Value getter(ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea)
+        {
+            return materializeLazyBuiltinMethod(state, self, privateDataFromObjectPrivateArea, name, fn, argc);
+        }
+
+        static bool setter(ExecutionState& state, Object* self, const Value& receiver, EncodedValue& privateDataFromObjectPrivateArea, const Value& setterInputData)
+        {
+            replaceLazyBuiltinMethod(state, self, name, setterInputData);
+            privateDataFromObjectPrivateArea = setterInputData;
+            return true;
+        }
+
+        static ObjectPropertyNativeGetterSetterData s_nativeData;
+    };
+
+    void defineLazyBuiltinMethod(ExecutionState& state, Object* target, AtomicString StaticStrings::*name, ObjectPropertyNativeGetterSetterData* nativeData);
+    static Value materializeLazyBuiltinMethod(ExecutionState& state, Object* target, const EncodedValue& globalObject, AtomicString StaticStrings::*name, NativeFunctionPointer fn, size_t argc);
+    static void replaceLazyBuiltinMethod(ExecutionState& state, Object* target, AtomicString StaticStrings::*name, const Value& value);
 };
+
+// builtin methods are writable, non-enumerable and configurable
+template <AtomicString StaticStrings::*name, NativeFunctionPointer fn, size_t argc>
+ObjectPropertyNativeGetterSetterData GlobalObject::LazyBuiltinMethod<name, fn, argc>::s_nativeData(true, false, true,
+                                                                                                    &GlobalObject::LazyBuiltinMethod<name, fn, argc>::getter, &GlobalObject::LazyBuiltinMethod<name, fn, argc>::setter);
+
+#define DEFINE_LAZY_BUILTIN_METHOD(state, target, methodName, nativeFunction, argumentCount) \
+    defineLazyBuiltinMethod(state, target, &StaticStrings::methodName,                       \
+                            &GlobalObject::LazyBuiltinMethod<&StaticStrings::methodName, nativeFunction, argumentCount>::s_nativeData)
 } // namespace Escargot
 
 #endif
@@ -21,6 +21,7 @@
 #include "IteratorObject.h"
 #include "runtime/Context.h"
 #include "runtime/VMInstance.h"
+#include "runtime/GlobalObject.h"
 #include "runtime/Object.h"
 #include "runtime/ErrorObject.h"
 #include "runtime/AsyncFromSyncIteratorObject.h"
@@ -135,9 +136,30 @@ Optional<Object*> IteratorObject::iteratorStep(ExecutionState& state, IteratorRe
     return done ? nullptr : result;
 }
 
+bool IteratorObject::canStepWithoutResultObject(ExecutionState& state, IteratorRecord* iteratorRecord)
+{
+    if (!iteratorRecord->m_iterator->isArrayIteratorObject()) {
+        return false;
+    }
+
+    // [[NextMethod]] is fixed when the record is created
+    // so the original %ArrayIteratorPrototype%.next guarantees nobody can observe the result object
+    Value nextMethod = iteratorRecord->m_nextMethod;
+    return nextMethod.isObject() && nextMethod.asObject() == state.context()->globalObject()->arrayIteratorPrototypeNext();
+}
+
 // https://tc39.es/ecma262/#sec-iteratorstepvalue
 Optional<Value> IteratorObject::iteratorStepValue(ExecutionState& state, IteratorRecord* iteratorRecord)
 {
+    if (canStepWithoutResultObject(state, iteratorRecord)) {
+        // skip allocating {value, done} object which is read and dropped right away
+        auto result = iteratorRecord->m_iterator->asIteratorObject()->advance(state);
+        if (result.second) {
+            return NullOption;
+        }
+        return result.first;
+    }
+
     // Let result be ? IteratorStep(iteratorRecord).
     auto result = iteratorStep(state, iteratorRecord);
     // If result is done, then
@@ -219,13 +241,12 @@ ValueVectorWithInlineStorage IteratorObject::iterableToList(ExecutionState& stat
         iteratorRecord = IteratorObject::getIterator(state, items, true);
     }
     ValueVectorWithInlineStorage values;
-    Optional<Object*> next;
+    Optional<Value> next;
 
     while (true) {
-        next = IteratorObject::iteratorStep(state, iteratorRecord);
+        next = IteratorObject::iteratorStepValue(state, iteratorRecord);
         if (next.hasValue()) {
-            Value nextValue = IteratorObject::iteratorValue(state, next.value());
-            values.pushBack(nextValue);
+            values.pushBack(next.value());
         } else {
             break;
         }
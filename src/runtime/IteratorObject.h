@@ -109,6 +109,8 @@ public:
     static Optional<Object*> iteratorStep(ExecutionState& state, IteratorRecord* iteratorRecord);
     // return null option value when iterator done
     static Optional<Value> iteratorStepValue(ExecutionState& state, IteratorRecord* iteratorRecord);
+    // true when stepping iteratorRecord can call advance() directly without creating {value, done} object
+    static bool canStepWithoutResultObject(ExecutionState& state, IteratorRecord* iteratorRecord);
     static Value iteratorClose(ExecutionState& state, IteratorRecord* iteratorRecord, const Value& completionValue, bool hasThrowOnCompletionType);
     static Object* createIterResultObject(ExecutionState& state, const Value& value, bool done);
     // https://www.ecma-international.org/ecma-262/10.0/#sec-iterabletolist
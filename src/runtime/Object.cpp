@@ -802,9 +802,24 @@ bool Object::defineOwnPropertyMethod(ExecutionState& state, const ObjectProperty
         // ASSERT(m_values.size() == m_structure->propertyCount());
         return true;
     } else {
+        Value v;
+        if (findResult.second->m_descriptor.isNativeAccessorProperty()) {
+            ObjectStructure* structureBefore = m_structure;
+            v = this->get(state, ObjectPropertyName(state, propertyName)).value(state, this);
+            if (UNLIKELY(structureBefore != m_structure)) {
+                // native getter can replace its own property (e.g. lazy builtin method)
+                // so we should find the property again
+                findResult = m_structure->findProperty(propertyName);
+                ASSERT(findResult.first != SIZE_MAX);
+            }
+        }
+
         size_t idx = findResult.first;
         const ObjectStructureItem* item = findResult.second.value();
         auto current = item->m_descriptor;
+        if (!current.isNativeAccessorProperty()) {
+            v = m_values[idx];
+        }
 
         // If the [[Configurable]] field of current is false then
         if (!current.isConfigurable()) {
@@ -819,7 +834,6 @@ bool Object::defineOwnPropertyMethod(ExecutionState& state, const ObjectProperty
         }
 
         bool shouldDelete = false;
-        Value v = current.isNativeAccessorProperty() ? this->get(state, ObjectPropertyName(state, propertyName)).value(state, this) : Value(m_values[idx]);
         ObjectPropertyDescriptor newDesc = ObjectPropertyDescriptor::fromObjectStructurePropertyDescriptor(current, v);
 
         // If IsGenericDescriptor(Desc) is true, then
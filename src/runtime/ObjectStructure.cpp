@@ -37,6 +37,17 @@ void* ObjectStructureItemVector::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+ObjectStructureSharedItemVector* ObjectStructureSharedItemVector::create(const ObjectStructureItem* items, size_t size, size_t capacity)
+{
+    ASSERT(size <= capacity);
+    // items are allocated right after the header
+    ObjectStructureSharedItemVector* vector = reinterpret_cast<ObjectStructureSharedItemVector*>(CustomAllocator<ObjectStructureItem>().allocate(capacity + 1));
+    vector->m_size = size;
+    vector->m_capacity = capacity;
+    memcpy(vector->data(), items, size * sizeof(ObjectStructureItem));
+    return vector;
+}
+
 void* ObjectStructureWithoutTransition::operator new(size_t size)
 {
     static MAY_THREAD_LOCAL bool typeInited = false;
@@ -51,6 +62,19 @@ void* ObjectStructureWithoutTransition::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+ObjectStructure::MemoryUsage ObjectStructure::computeMemoryUsage()
+{
+    HeapObjectKindUsage usage[HeapObjectKind::NumberOfKind];
+    measureHeapObjectKindUsage(usage);
+
+    MemoryUsage result;
+    result.propertyTableCount = usage[HeapObjectKind::ObjectStructureItemVectorKind].count;
+    result.propertyTableBytes = usage[HeapObjectKind::ObjectStructureItemVectorKind].bytes;
+    result.transitionTableCount = usage[HeapObjectKind::ObjectStructureTransitionVectorKind].count;
+    result.transitionTableBytes = usage[HeapObjectKind::ObjectStructureTransitionVectorKind].bytes;
+    return result;
+}
+
 ObjectStructure* ObjectStructure::create(Context* ctx, ObjectStructureItemTightVector&& properties, bool preferTransition)
 {
     bool hasIndexStringAsPropertyName = false;
@@ -229,6 +253,7 @@ void* ObjectStructureWithTransition::operator new(size_t size)
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ObjectStructureWithTransition)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithTransition, m_properties));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithTransition, m_parent));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithTransition, m_transitionTableVectorBuffer));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectStructureWithTransition));
         typeInited = true;
@@ -238,35 +263,36 @@ void* ObjectStructureWithTransition::operator new(size_t size)
 
 std::pair<size_t, Optional<const ObjectStructureItem*>> ObjectStructureWithTransition::findProperty(const ObjectStructurePropertyName& s)
 {
-    size_t size = m_properties.size();
+    size_t size = m_propertyCount;
+    const ObjectStructureItem* properties = m_properties->data();
 
     if (LIKELY(s.hasAtomicString())) {
         if (LIKELY(!m_hasNonAtomicPropertyName)) {
             for (size_t i = 0; i < size; i++) {
-                if (m_properties[i].m_propertyName.rawValue() == s.rawValue()) {
-                    return std::make_pair(i, &m_properties[i]);
+                if (properties[i].m_propertyName.rawValue() == s.rawValue()) {
+                    return std::make_pair(i, &properties[i]);
                 }
             }
         } else {
             AtomicString as = s.asAtomicString();
             for (size_t i = 0; i < size; i++) {
-                if (m_properties[i].m_propertyName == as) {
-                    return std::make_pair(i, &m_properties[i]);
+                if (properties[i].m_propertyName == as) {
+                    return std::make_pair(i, &properties[i]);
                 }
             }
         }
     } else if (s.isSymbol()) {
         if (m_hasSymbolPropertyName) {
             for (size_t i = 0; i < size; i++) {
-                if (m_properties[i].m_propertyName == s) {
-                    return std::make_pair(i, &m_properties[i]);
+                if (properties[i].m_propertyName == s) {
+                    return std::make_pair(i, &properties[i]);
                 }
             }
         }
     } else {
         for (size_t i = 0; i < size; i++) {
-            if (m_properties[i].m_propertyName == s) {
-                return std::make_pair(i, &m_properties[i]);
+            if (properties[i].m_propertyName == s) {
+                return std::make_pair(i, &properties[i]);
             }
         }
     }
@@ -276,21 +302,23 @@ std::pair<size_t, Optional<const ObjectStructureItem*>> ObjectStructureWithTrans
 
 const ObjectStructureItem& ObjectStructureWithTransition::readProperty(size_t idx)
 {
-    return m_properties[idx];
+    ASSERT(idx < m_propertyCount);
+    return m_properties->data()[idx];
 }
 
 const ObjectStructureItem* ObjectStructureWithTransition::properties() const
 {
-    return m_properties.data();
+    return m_properties->data();
 }
 
 size_t ObjectStructureWithTransition::propertyCount() const
 {
-    return m_properties.size();
+    return m_propertyCount;
 }
 
 ObjectStructure* ObjectStructureWithTransition::addProperty(const ObjectStructurePropertyName& name, const ObjectStructurePropertyDescriptor& desc)
 {
+    size_t emptySlot = SIZE_MAX;
     if (m_doesTransitionTableUseMap) {
         auto iter = m_transitionTableMap->find(ObjectStructureTransitionMapItem(name, desc));
         if (iter != m_transitionTableMap->end()) {
@@ -300,6 +328,14 @@ ObjectStructure* ObjectStructureWithTransition::addProperty(const ObjectStructur
         size_t len = m_transitionTableVectorBufferSize;
         for (size_t i = 0; i < len; i++) {
             const auto& item = m_transitionTableVectorBuffer[i];
+            // m_structure is cleared by gc when the structure is collected
+            // name and descriptor of the item are kept alive by the structure only
+            if (!item.m_structure) {
+                if (emptySlot == SIZE_MAX) {
+                    emptySlot = i;
+                }
+                continue;
+            }
             if (item.m_descriptor == desc && item.m_propertyName == name) {
                 return item.m_structure;
             }
@@ -313,41 +349,73 @@ ObjectStructure* ObjectStructureWithTransition::addProperty(const ObjectStructur
     bool hasEnumerableProperty = m_hasEnumerableProperty ? true : desc.isEnumerable();
     ObjectStructure* newObjectStructure;
 
-    size_t nextSize = m_properties.size() + 1;
+    size_t nextSize = m_propertyCount + 1;
     // ObjectStructureWithTransition cannot directly convert to ObjectStructureWithMap by just adding one property
     ASSERT(nextSize < ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE);
     if (nextSize > ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE || nameIsIndexString) {
-        ObjectStructureItemVector* newProperties = new ObjectStructureItemVector(m_properties, newItem);
+        ObjectStructureItemVector* newProperties = new ObjectStructureItemVector(m_properties->data(), m_properties->data() + m_propertyCount, newItem);
         newObjectStructure = new ObjectStructureWithoutTransition(newProperties, nameIsIndexString, hasSymbol, hasNonAtomicName, hasEnumerableProperty);
     } else {
-        ObjectStructureItemTightVector newProperties(m_properties, newItem);
-        newObjectStructure = new ObjectStructureWithTransition(std::move(newProperties), nameIsIndexString, hasSymbol, hasNonAtomicName, hasEnumerableProperty);
+        // append to the shared table if this structure owns the end of it
+        // otherwise another transition already appended its property, so copy our part
+        ObjectStructureSharedItemVector* newProperties = m_properties;
+        if (newProperties->m_size != m_propertyCount || newProperties->m_size == newProperties->m_capacity) {
+            newProperties = ObjectStructureSharedItemVector::create(m_properties->data(), m_propertyCount, computeSharedVectorCapacity(nextSize));
+        }
+        newProperties->data()[m_propertyCount] = newItem;
+        newProperties->m_size = nextSize;
+
+        newObjectStructure = new ObjectStructureWithTransition(this, newProperties, nextSize, nameIsIndexString, hasSymbol, hasNonAtomicName, hasEnumerableProperty);
         ObjectStructureTransitionVectorItem newTransitionItem(name, desc, newObjectStructure);
 
         if (m_doesTransitionTableUseMap) {
             m_transitionTableMap->insert(std::make_pair(ObjectStructureTransitionMapItem(newTransitionItem.m_propertyName, newTransitionItem.m_descriptor),
                                                         newTransitionItem.m_structure));
+        } else if (emptySlot != SIZE_MAX) {
+            // reuse the slot of collected structure
+            m_transitionTableVectorBuffer[emptySlot] = newTransitionItem;
+            registerTransitionLink(m_transitionTableVectorBuffer[emptySlot]);
         } else {
             if (m_transitionTableVectorBufferSize + 1 > ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MAP_MIN_SIZE) {
+                // structure with many transitions is rare. transition map refers structures strongly
                 ObjectStructureTransitionTableMap* transitionTableMap = new (GC) ObjectStructureTransitionTableMap();
                 for (size_t i = 0; i < m_transitionTableVectorBufferSize; i++) {
-                    transitionTableMap->insert(std::make_pair(ObjectStructureTransitionMapItem(m_transitionTableVectorBuffer[i].m_propertyName, m_transitionTableVectorBuffer[i].m_descriptor),
-                                                              m_transitionTableVectorBuffer[i].m_structure));
+                    auto& item = m_transitionTableVectorBuffer[i];
+                    if (item.m_structure) {
+                        unregisterTransitionLink(item);
+                        transitionTableMap->insert(std::make_pair(ObjectStructureTransitionMapItem(item.m_propertyName, item.m_descriptor),
+                                                                  item.m_structure));
+                    }
                 }
                 transitionTableMap->insert(std::make_pair(ObjectStructureTransitionMapItem(newTransitionItem.m_propertyName, newTransitionItem.m_descriptor),
                                                           newTransitionItem.m_structure));
 
-                GC_FREE(m_transitionTableVectorBuffer);
+                CustomAllocator<ObjectStructureTransitionVectorItem>().deallocate(m_transitionTableVectorBuffer);
                 m_doesTransitionTableUseMap = true;
                 m_transitionTableMap = transitionTableMap;
                 m_transitionTableVectorBufferCapacity = 0;
                 m_transitionTableVectorBufferSize = 0;
             } else {
                 if (m_transitionTableVectorBufferCapacity <= (size_t)(m_transitionTableVectorBufferSize + 1)) {
-                    m_transitionTableVectorBufferCapacity = std::min(computeVectorAllocateSize(m_transitionTableVectorBufferSize + 1), (size_t)std::numeric_limits<uint8_t>::max());
-                    m_transitionTableVectorBuffer = (ObjectStructureTransitionVectorItem*)GC_REALLOC_NO_SHRINK(m_transitionTableVectorBuffer, sizeof(ObjectStructureTransitionVectorItem) * m_transitionTableVectorBufferCapacity);
+                    // links should move to the new buffer, so we cannot use GC_REALLOC here
+                    size_t newCapacity = std::min(computeVectorAllocateSize(m_transitionTableVectorBufferSize + 1), (size_t)std::numeric_limits<uint8_t>::max());
+                    ObjectStructureTransitionVectorItem* newBuffer = CustomAllocator<ObjectStructureTransitionVectorItem>().allocate(newCapacity);
+                    for (size_t i = 0; i < m_transitionTableVectorBufferSize; i++) {
+                        auto& item = m_transitionTableVectorBuffer[i];
+                        newBuffer[i] = item;
+                        if (item.m_structure) {
+                            unregisterTransitionLink(item);
+                            registerTransitionLink(newBuffer[i]);
+                        }
+                    }
+                    if (m_transitionTableVectorBuffer) {
+                        CustomAllocator<ObjectStructureTransitionVectorItem>().deallocate(m_transitionTableVectorBuffer);
+                    }
+                    m_transitionTableVectorBuffer = newBuffer;
+                    m_transitionTableVectorBufferCapacity = newCapacity;
                 }
                 m_transitionTableVectorBuffer[m_transitionTableVectorBufferSize] = newTransitionItem;
+                registerTransitionLink(m_transitionTableVectorBuffer[m_transitionTableVectorBufferSize]);
                 m_transitionTableVectorBufferSize++;
             }
         }
@@ -359,8 +427,9 @@ ObjectStructure* ObjectStructureWithTransition::addProperty(const ObjectStructur
 ObjectStructure* ObjectStructureWithTransition::removeProperty(size_t pIndex)
 {
     ObjectStructureItemVector* newProperties = new ObjectStructureItemVector();
-    newProperties->resizeFitWithUninitializedValues(m_properties.size() - 1);
-    size_t pc = m_properties.size();
+    newProperties->resizeFitWithUninitializedValues(m_propertyCount - 1);
+    size_t pc = m_propertyCount;
+    const ObjectStructureItem* properties = m_properties->data();
 
     size_t newIdx = 0;
     bool hasIndexString = false;
@@ -370,12 +439,12 @@ ObjectStructure* ObjectStructureWithTransition::removeProperty(size_t pIndex)
     for (size_t i = 0; i < pc; i++) {
         if (i == pIndex)
             continue;
-        hasIndexString = hasIndexString | m_properties[i].m_propertyName.isIndexString();
-        hasSymbol = hasSymbol | m_properties[i].m_propertyName.isSymbol();
-        hasNonAtomicName = hasNonAtomicName | !m_properties[i].m_propertyName.hasAtomicString();
-        hasEnumerableProperty = hasEnumerableProperty | m_properties[i].m_descriptor.isEnumerable();
-        (*newProperties)[newIdx].m_propertyName = m_properties[i].m_propertyName;
-        (*newProperties)[newIdx].m_descriptor = m_properties[i].m_descriptor;
+        hasIndexString = hasIndexString | properties[i].m_propertyName.isIndexString();
+        hasSymbol = hasSymbol | properties[i].m_propertyName.isSymbol();
+        hasNonAtomicName = hasNonAtomicName | !properties[i].m_propertyName.hasAtomicString();
+        hasEnumerableProperty = hasEnumerableProperty | properties[i].m_descriptor.isEnumerable();
+        (*newProperties)[newIdx].m_propertyName = properties[i].m_propertyName;
+        (*newProperties)[newIdx].m_descriptor = properties[i].m_descriptor;
         newIdx++;
     }
 
@@ -384,14 +453,14 @@ ObjectStructure* ObjectStructureWithTransition::removeProperty(size_t pIndex)
 
 ObjectStructure* ObjectStructureWithTransition::replacePropertyDescriptor(size_t idx, const ObjectStructurePropertyDescriptor& newDesc)
 {
-    ObjectStructureItemVector* newProperties = new ObjectStructureItemVector(m_properties);
+    ObjectStructureItemVector* newProperties = new ObjectStructureItemVector(m_properties->data(), m_properties->data() + m_propertyCount);
     newProperties->at(idx).m_descriptor = newDesc;
     return new ObjectStructureWithoutTransition(newProperties, m_hasIndexPropertyName, m_hasSymbolPropertyName, m_hasNonAtomicPropertyName, m_hasEnumerableProperty);
 }
 
 ObjectStructure* ObjectStructureWithTransition::convertToNonTransitionStructure()
 {
-    ObjectStructureItemVector* newProperties = new ObjectStructureItemVector(m_properties);
+    ObjectStructureItemVector* newProperties = new ObjectStructureItemVector(m_properties->data(), m_properties->data() + m_propertyCount);
     return new ObjectStructureWithoutTransition(newProperties, m_hasIndexPropertyName, m_hasSymbolPropertyName, m_hasNonAtomicPropertyName, m_hasEnumerableProperty);
 }
 
@@ -68,10 +68,10 @@ typedef HashMap<ObjectStructureTransitionMapItem, ObjectStructure*, std::hash<Ob
                 std::equal_to<ObjectStructureTransitionMapItem>, GCUtil::gc_malloc_allocator<std::pair<ObjectStructureTransitionMapItem const, ObjectStructure*>>>
     ObjectStructureTransitionTableMap;
 
-typedef TightVector<ObjectStructureItem, GCUtil::gc_malloc_allocator<ObjectStructureItem>> ObjectStructureItemTightVector;
+typedef TightVector<ObjectStructureItem, CustomAllocator<ObjectStructureItem>> ObjectStructureItemTightVector;
 
-class ObjectStructureItemVector : public Vector<ObjectStructureItem, GCUtil::gc_malloc_allocator<ObjectStructureItem>> {
-    typedef Vector<ObjectStructureItem, GCUtil::gc_malloc_allocator<ObjectStructureItem>> ObjectStructureItemVectorType;
+class ObjectStructureItemVector : public Vector<ObjectStructureItem, CustomAllocator<ObjectStructureItem>> {
+    typedef Vector<ObjectStructureItem, CustomAllocator<ObjectStructureItem>> ObjectStructureItemVectorType;
 
 public:
     ObjectStructureItemVector()
@@ -83,6 +83,19 @@ public:
         assign(other.data(), other.data() + other.size());
     }
 
+    ObjectStructureItemVector(const ObjectStructureItem* start, const ObjectStructureItem* end)
+    {
+        assign(start, end);
+    }
+
+    ObjectStructureItemVector(const ObjectStructureItem* start, const ObjectStructureItem* end, const ObjectStructureItem& newItem)
+    {
+        size_t size = std::distance(start, end);
+        resizeWithUninitializedValues(size + 1);
+        memcpy(data(), start, size * sizeof(ObjectStructureItem));
+        at(size) = newItem;
+    }
+
     ObjectStructureItemVector(const ObjectStructureItemVector& other)
         : ObjectStructureItemVectorType(other)
     {
@@ -97,6 +110,24 @@ public:
     void* operator new[](size_t size) = delete;
 };
 
+// property table shared by a chain of ObjectStructureWithTransition
+// a structure made by transition appends its new property to the table of its parent
+// if the parent owns the end of the table. otherwise it copies the table
+// so each structure sees only the first `propertyCount` items, and appended items are never modified
+struct ObjectStructureSharedItemVector {
+    size_t m_size;
+    size_t m_capacity;
+
+    ObjectStructureItem* data()
+    {
+        return reinterpret_cast<ObjectStructureItem*>(this + 1);
+    }
+
+    static ObjectStructureSharedItemVector* create(const ObjectStructureItem* items, size_t size, size_t capacity);
+};
+
+COMPILE_ASSERT(sizeof(ObjectStructureSharedItemVector) == sizeof(ObjectStructureItem), "");
+
 #if defined(ESCARGOT_SMALL_CONFIG)
 #ifndef ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE
 #define ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE 2048
@@ -125,6 +156,16 @@ class ObjectStructure : public gc {
 public:
     virtual ~ObjectStructure() {}
 
+    // memory used by property tables and transition tables reachable in the current thread
+    // this runs gc to get precise result. so don't call this in performance-critical path
+    struct MemoryUsage {
+        size_t propertyTableCount;
+        size_t propertyTableBytes;
+        size_t transitionTableCount;
+        size_t transitionTableBytes;
+    };
+    static MemoryUsage computeMemoryUsage();
+
     static bool isTransitionModeAvailable(size_t propertyCount)
     {
         return propertyCount <= ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE;
@@ -318,11 +359,24 @@ public:
     ObjectStructureWithTransition(ObjectStructureItemTightVector&& properties, bool hasIndexPropertyName, bool hasSymbolPropertyName, bool hasNonAtomicPropertyName, bool hasEnumerableProperty)
         : ObjectStructure(hasIndexPropertyName,
                           hasSymbolPropertyName, hasNonAtomicPropertyName, hasEnumerableProperty)
-        , m_properties(std::move(properties))
+        , m_properties(ObjectStructureSharedItemVector::create(properties.data(), properties.size(), computeSharedVectorCapacity(properties.size())))
+        , m_propertyCount(properties.size())
+        , m_parent(nullptr)
         , m_transitionTableVectorBuffer(nullptr)
     {
     }
 
+    ObjectStructureWithTransition(ObjectStructureWithTransition* parent, ObjectStructureSharedItemVector* properties, size_t propertyCount, bool hasIndexPropertyName, bool hasSymbolPropertyName, bool hasNonAtomicPropertyName, bool hasEnumerableProperty)
+        : ObjectStructure(hasIndexPropertyName,
+                          hasSymbolPropertyName, hasNonAtomicPropertyName, hasEnumerableProperty)
+        , m_properties(properties)
+        , m_propertyCount(propertyCount)
+        , m_parent(parent)
+        , m_transitionTableVectorBuffer(nullptr)
+    {
+        ASSERT(propertyCount <= properties->m_size);
+    }
+
     virtual std::pair<size_t, Optional<const ObjectStructureItem*>> findProperty(const ObjectStructurePropertyName& s) override;
     virtual const ObjectStructureItem& readProperty(size_t idx) override;
     virtual const ObjectStructureItem* properties() const override;
@@ -350,7 +404,28 @@ private:
         return size_t(1) << (base + 1);
     }
 
-    ObjectStructureItemTightVector m_properties;
+    size_t computeSharedVectorCapacity(size_t newSize)
+    {
+        // leave room for next transitions. structures beyond the limit are not in transition mode
+        return std::max(newSize, std::min(computeVectorAllocateSize(newSize), static_cast<size_t>(ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE)));
+    }
+
+    // transition table in vector mode refers structures weakly
+    // so unused branches of transition tree can be collected
+    // a structure refers its parent strongly. live structure keeps whole path from the root alive
+    static void registerTransitionLink(ObjectStructureTransitionVectorItem& item)
+    {
+        GC_GENERAL_REGISTER_DISAPPEARING_LINK_SAFE(reinterpret_cast<void**>(&item.m_structure), item.m_structure);
+    }
+
+    static void unregisterTransitionLink(ObjectStructureTransitionVectorItem& item)
+    {
+        GC_unregister_disappearing_link(reinterpret_cast<void**>(&item.m_structure));
+    }
+
+    ObjectStructureSharedItemVector* m_properties;
+    size_t m_propertyCount;
+    ObjectStructureWithTransition* m_parent;
     union {
         ObjectStructureTransitionVectorItem* m_transitionTableVectorBuffer;
         ObjectStructureTransitionTableMap* m_transitionTableMap;
@@ -358,7 +433,7 @@ private:
 };
 
 COMPILE_ASSERT(ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MAP_MIN_SIZE <= 32, "");
-COMPILE_ASSERT(sizeof(ObjectStructureWithTransition) == sizeof(size_t) * 5, "");
+COMPILE_ASSERT(sizeof(ObjectStructureWithTransition) == sizeof(size_t) * 6, "");
 
 class PropertyNameMapWithCache : protected PropertyNameMap, public gc {
     struct CacheItem {
@@ -61,16 +61,35 @@ ScriptFunctionObject::ScriptFunctionObject(ExecutionState& state, Object* proto,
 #endif
 }
 
-NEVER_INLINE void ScriptFunctionObject::generateByteCodeBlock(ExecutionState& state)
+void ScriptFunctionObject::generateByteCode(ExecutionState& state, InterpretedCodeBlock* codeBlock)
 {
-    ASSERT(m_codeBlock->isInterpretedCodeBlock());
+    bool isRegeneration = codeBlock->isByteCodeBlockPruned();
+    uint64_t regenerationStartTime = isRegeneration ? longTickCount() : 0;
 
-    state.context()->scriptParser().generateFunctionByteCode(state, interpretedCodeBlock());
+    state.context()->scriptParser().generateFunctionByteCode(state, codeBlock);
+
+    if (UNLIKELY(isRegeneration)) {
+        codeBlock->setByteCodeBlockPruned(false);
+        state.context()->vmInstance()->recordByteCodeRegeneration(longTickCount() - regenerationStartTime);
+    }
 
     auto& currentCodeSizeTotal = state.context()->vmInstance()->compiledByteCodeSize();
     ASSERT(currentCodeSizeTotal < std::numeric_limits<size_t>::max());
-    currentCodeSizeTotal += interpretedCodeBlock()->byteCodeBlock()->memoryAllocatedSize();
+    currentCodeSizeTotal += codeBlock->byteCodeBlock()->memoryAllocatedSize();
+}
+
+NEVER_INLINE void ScriptFunctionObject::generateByteCodeBlock(ExecutionState& state)
+{
+    ASSERT(m_codeBlock->isInterpretedCodeBlock());
+
+    generateByteCode(state, interpretedCodeBlock());
+    useSimpleFunctionCallPathIfPossible();
+}
+
+void ScriptFunctionObject::useSimpleFunctionCallPathIfPossible()
+{
     auto cb = m_codeBlock->asInterpretedCodeBlock();
+    ASSERT(cb->byteCodeBlock());
 
     if (hasVTag(g_scriptFunctionObjectTag) && !cb->byteCodeBlock()->needsExtendedExecutionState()) {
         auto byteCb = cb->byteCodeBlock();
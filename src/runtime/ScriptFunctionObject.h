@@ -111,6 +111,10 @@ protected:
 
     void generateArgumentsObject(ExecutionState& state, size_t argc, Value* argv, FunctionEnvironmentRecord* environmentRecordWillArgumentsObjectBeLocatedIn, Value* stackStorage, bool isMapped);
     void generateByteCodeBlock(ExecutionState& state);
+    // generate ByteCodeBlock of codeBlock and update bytecode statistics of VMInstance
+    static void generateByteCode(ExecutionState& state, InterpretedCodeBlock* codeBlock);
+    // change vtag into ScriptSimpleFunctionObject if ByteCodeBlock allows it
+    void useSimpleFunctionCallPathIfPossible();
 
     static inline void fillGCDescriptor(GC_word* desc)
     {
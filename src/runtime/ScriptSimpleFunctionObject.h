@@ -60,6 +60,7 @@ protected:
         }
 
         ByteCodeBlock* blk = codeBlock->byteCodeBlock();
+        blk->m_executionCount++;
         Context* ctx = codeBlock->context();
         const size_t registerSize = blk->m_requiredOperandRegisterNumber;
         const size_t programStart = reinterpret_cast<const size_t>(blk->m_code.data());
@@ -148,6 +149,7 @@ protected:
         }
 
         ByteCodeBlock* blk = codeBlock->byteCodeBlock();
+        blk->m_executionCount++;
         Context* ctx = codeBlock->context();
         const size_t registerSize = blk->m_requiredOperandRegisterNumber;
 
@@ -20,6 +20,7 @@
 #include "Escargot.h"
 #include "runtime/ThreadLocal.h"
 #include "heap/Heap.h"
+#include "heap/ArrayBufferAllocator.h"
 #include "runtime/Global.h"
 #include "runtime/Platform.h"
 #include "runtime/String.h"
@@ -86,6 +87,8 @@ MAY_THREAD_LOCAL bf_context_t ThreadLocal::g_bfContext;
 MAY_THREAD_LOCAL WASMContext ThreadLocal::g_wasmContext;
 #endif
 MAY_THREAD_LOCAL GCEventListenerSet* ThreadLocal::g_gcEventListenerSet;
+MAY_THREAD_LOCAL GCStatistics* ThreadLocal::g_gcStatistics;
+MAY_THREAD_LOCAL size_t ThreadLocal::g_arrayBufferBytes;
 MAY_THREAD_LOCAL ASTAllocator* ThreadLocal::g_astAllocator;
 MAY_THREAD_LOCAL WTF::BumpPointerAllocator* ThreadLocal::g_bumpPointerAllocator;
 #if defined(ENABLE_TCO)
@@ -145,8 +148,79 @@ void GCEventListenerSet::reset()
     }
 }
 
+size_t GCStatistics::currentHeapUsage()
+{
+    // these getters are lock-free, so it is safe to call them inside of collection event
+    // both of heap size and free bytes exclude unmapped bytes
+    size_t heapSize = GC_get_heap_size();
+    size_t freeBytes = GC_get_free_bytes();
+    return heapSize > freeBytes ? heapSize - freeBytes : 0;
+}
+
+void GCStatistics::onEvent(GC_EventType evtType)
+{
+    switch (evtType) {
+    case GC_EVENT_START:
+        m_gcStartTime = longTickCount();
+        m_markStartTime = m_reclaimStartTime = m_gcStartTime;
+        m_lastMarkTime = m_lastSweepTime = 0;
+        m_lastAllocatedBytes = GC_get_bytes_since_gc();
+        m_lastHeapUsageBefore = currentHeapUsage();
+        break;
+    case GC_EVENT_MARK_START:
+        m_markStartTime = longTickCount();
+        break;
+    case GC_EVENT_MARK_END:
+        m_lastMarkTime = longTickCount() - m_markStartTime;
+        break;
+    case GC_EVENT_RECLAIM_START:
+        m_reclaimStartTime = longTickCount();
+        break;
+    case GC_EVENT_RECLAIM_END:
+        m_lastSweepTime = longTickCount() - m_reclaimStartTime;
+        break;
+    case GC_EVENT_END: {
+        uint64_t pauseTime = longTickCount() - m_gcStartTime;
+        m_gcCount++;
+        m_lastPauseTime = pauseTime;
+        m_totalPauseTime += pauseTime;
+        m_maxPauseTime = std::max(m_maxPauseTime, pauseTime);
+
+        // bdwgc may sweep lazily, so reclaimed bytes only count what is swept in this cycle
+        m_lastHeapUsageAfter = currentHeapUsage();
+        m_lastReclaimedBytes = m_lastHeapUsageBefore > m_lastHeapUsageAfter ? m_lastHeapUsageBefore - m_lastHeapUsageAfter : 0;
+        m_totalReclaimedBytes += m_lastReclaimedBytes;
+
+        if (m_pauseHistory.size() < GC_STATISTICS_PAUSE_HISTORY_SIZE) {
+            m_pauseHistory.push_back(pauseTime);
+        } else {
+            m_pauseHistory[m_pauseHistoryIndex] = pauseTime;
+            m_pauseHistoryIndex = (m_pauseHistoryIndex + 1) % GC_STATISTICS_PAUSE_HISTORY_SIZE;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+uint64_t GCStatistics::pauseTimePercentile(double p) const
+{
+    if (m_pauseHistory.empty()) {
+        return 0;
+    }
+
+    std::vector<uint64_t> sorted(m_pauseHistory);
+    std::sort(sorted.begin(), sorted.end());
+    p = std::max(0.0, std::min(100.0, p));
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) / 100.0 + 0.5);
+    return sorted[index];
+}
+
 static void genericGCEventListener(GC_EventType evtType)
 {
+    ThreadLocal::gcStatistics().onEvent(evtType);
+
     GCEventListenerSet& list = ThreadLocal::gcEventListenerSet();
     Optional<GCEventListenerSet::EventListenerVector*> listeners;
 
@@ -313,6 +387,7 @@ void ThreadLocal::initialize()
 
     // g_gcEventListenerSet
     g_gcEventListenerSet = new GCEventListenerSet();
+    g_gcStatistics = new GCStatistics();
     // in addition, register genericGCEventListener here too
     GC_set_on_collection_event(genericGCEventListener);
 
@@ -355,6 +430,8 @@ void ThreadLocal::finalize()
     // full gc(Heap::finalize) should be invoked after g_customData deallocation
     // because g_customData might contain GC-object
     Heap::finalize();
+    // ArrayBuffer data freed by finalizers above can be pooled
+    ArrayBufferAllocator::releasePooledBuffers();
 
     // g_randEngine does not need finalization
     delete g_randEngine;
@@ -375,6 +452,8 @@ void ThreadLocal::finalize()
     // g_gcEventListenerSet
     delete g_gcEventListenerSet;
     g_gcEventListenerSet = nullptr;
+    delete g_gcStatistics;
+    g_gcStatistics = nullptr;
     GC_set_on_collection_event(nullptr);
 
     // g_astAllocator
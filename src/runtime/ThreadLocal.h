@@ -85,6 +85,74 @@ private:
     Optional<EventListenerVector*> m_reclaimEndListeners;
 };
 
+#ifndef GC_STATISTICS_PAUSE_HISTORY_SIZE
+#define GC_STATISTICS_PAUSE_HISTORY_SIZE 256
+#endif
+
+// per-thread gc telemetry collected from bdwgc collection events
+// every time value is in microseconds
+class GCStatistics {
+public:
+    GCStatistics()
+        : m_gcCount(0)
+        , m_lastMarkTime(0)
+        , m_lastSweepTime(0)
+        , m_lastPauseTime(0)
+        , m_totalPauseTime(0)
+        , m_maxPauseTime(0)
+        , m_lastAllocatedBytes(0)
+        , m_lastHeapUsageBefore(0)
+        , m_lastHeapUsageAfter(0)
+        , m_lastReclaimedBytes(0)
+        , m_totalReclaimedBytes(0)
+        , m_gcStartTime(0)
+        , m_markStartTime(0)
+        , m_reclaimStartTime(0)
+        , m_pauseHistoryIndex(0)
+    {
+    }
+
+    void onEvent(GC_EventType evtType);
+
+    // bytes of gc heap which are in use (including not yet swept garbage)
+    static size_t currentHeapUsage();
+
+    // returns p-th percentile(0 ~ 100) of recent pause times
+    uint64_t pauseTimePercentile(double p) const;
+
+    size_t gcCount() const { return m_gcCount; }
+    uint64_t lastMarkTime() const { return m_lastMarkTime; }
+    uint64_t lastSweepTime() const { return m_lastSweepTime; }
+    uint64_t lastPauseTime() const { return m_lastPauseTime; }
+    uint64_t totalPauseTime() const { return m_totalPauseTime; }
+    uint64_t maxPauseTime() const { return m_maxPauseTime; }
+    size_t lastAllocatedBytes() const { return m_lastAllocatedBytes; }
+    size_t lastHeapUsageBefore() const { return m_lastHeapUsageBefore; }
+    size_t lastHeapUsageAfter() const { return m_lastHeapUsageAfter; }
+    size_t lastReclaimedBytes() const { return m_lastReclaimedBytes; }
+    size_t totalReclaimedBytes() const { return m_totalReclaimedBytes; }
+
+private:
+    size_t m_gcCount;
+    uint64_t m_lastMarkTime;
+    uint64_t m_lastSweepTime;
+    uint64_t m_lastPauseTime;
+    uint64_t m_totalPauseTime;
+    uint64_t m_maxPauseTime;
+    size_t m_lastAllocatedBytes;
+    size_t m_lastHeapUsageBefore;
+    size_t m_lastHeapUsageAfter;
+    size_t m_lastReclaimedBytes;
+    size_t m_totalReclaimedBytes;
+
+    uint64_t m_gcStartTime;
+    uint64_t m_markStartTime;
+    uint64_t m_reclaimStartTime;
+    // ring buffer of recent pause times
+    std::vector<uint64_t> m_pauseHistory;
+    size_t m_pauseHistoryIndex;
+};
+
 // ThreadLocal has thread-local values
 // ThreadLocal should be created for each thread
 // ThreadLocal is a non-GC global object which means that users who want to customize it should manage memory by themselves
@@ -117,6 +185,9 @@ class ThreadLocal {
     static MAY_THREAD_LOCAL WASMContext g_wasmContext;
 #endif
     static MAY_THREAD_LOCAL GCEventListenerSet* g_gcEventListenerSet;
+    static MAY_THREAD_LOCAL GCStatistics* g_gcStatistics;
+    // bytes of non-shared ArrayBuffer data allocated by Platform on this thread
+    static MAY_THREAD_LOCAL size_t g_arrayBufferBytes;
     static MAY_THREAD_LOCAL ASTAllocator* g_astAllocator;
     static MAY_THREAD_LOCAL WTF::BumpPointerAllocator* g_bumpPointerAllocator;
 #if defined(ENABLE_TCO)
@@ -265,6 +336,30 @@ public:
         return *g_gcEventListenerSet;
     }
 
+    static GCStatistics& gcStatistics()
+    {
+        ASSERT(inited && !!g_gcStatistics);
+        return *g_gcStatistics;
+    }
+
+    static size_t arrayBufferBytes()
+    {
+        return g_arrayBufferBytes;
+    }
+
+    // ArrayBuffer data can be freed by finalizer after ThreadLocal is finalized
+    // so these don't check `inited`
+    static void increaseArrayBufferBytes(size_t bytes)
+    {
+        g_arrayBufferBytes += bytes;
+    }
+
+    static void decreaseArrayBufferBytes(size_t bytes)
+    {
+        ASSERT(g_arrayBufferBytes >= bytes);
+        g_arrayBufferBytes -= bytes;
+    }
+
     static ASTAllocator* astAllocator()
     {
         ASSERT(inited && !!g_astAllocator);
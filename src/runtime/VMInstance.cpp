@@ -31,6 +31,8 @@
 #include "runtime/ReloadableString.h"
 #include "intl/Intl.h"
 #include "interpreter/ByteCode.h"
+#include "parser/ASTAllocator.h"
+#include "heap/ArrayBufferAllocator.h"
 #if defined(ENABLE_CODE_CACHE)
 #include "codecache/CodeCache.h"
 #endif
@@ -196,6 +198,20 @@ void* VMInstance::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+#if !defined(ESCARGOT_DEBUGGER)
+static size_t byteCodeBlockAgeBucket(ByteCodeBlock* block, size_t epoch)
+{
+    // 0 for blocks used in this epoch, floor(log2(age)) + 1 for others
+    size_t age = epoch - block->m_lastUsedGCEpoch;
+    size_t bucket = 0;
+    while (age && bucket < SCRIPT_FUNCTION_OBJECT_BYTECODE_AGE_BUCKET_COUNT - 1) {
+        age >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+#endif
+
 void vmMarkStartCallback(void* data)
 {
 #if !defined(ESCARGOT_DEBUGGER)
@@ -209,17 +225,61 @@ void vmMarkStartCallback(void* data)
         self->m_regexpCache->clear();
     }
 
+    auto& v = self->compiledByteCodeBlocks();
+    size_t epoch = ++self->m_byteCodeGCEpoch;
+    for (size_t i = 0; i < v.size(); i++) {
+        if (v[i]->m_executionCount) {
+            v[i]->m_lastUsedGCEpoch = epoch;
+        }
+    }
+
     auto& currentCodeSizeTotal = self->compiledByteCodeSize();
-    if ((currentCodeSizeTotal > self->maxCompiledByteCodeSize() && (self->m_config & (size_t)VMInstance::ConfigFlag::PruneCompiledByteCodesWhileGC)) || UNLIKELY(inIdleMode && (self->m_config & (size_t)VMInstance::ConfigFlag::PruneCompiledByteCodesEnterIdle))) {
+    if (UNLIKELY(inIdleMode && (self->m_config & (size_t)VMInstance::ConfigFlag::PruneCompiledByteCodesEnterIdle))) {
+        self->m_compiledByteCodeSizeBeforePruning = currentCodeSizeTotal;
         currentCodeSizeTotal = std::numeric_limits<size_t>::max();
 
-        auto& v = self->compiledByteCodeBlocks();
         for (size_t i = 0; i < v.size(); i++) {
             // ByteCodeBlock of top CodeBlock should be remove by Script class
             if (v[i]->m_codeBlock->parent()) {
                 v[i]->m_codeBlock->setByteCodeBlock(nullptr);
+                v[i]->m_codeBlock->setByteCodeBlockPruned(true);
+            }
+        }
+    } else if (currentCodeSizeTotal > self->maxCompiledByteCodeSize() && (self->m_config & (size_t)VMInstance::ConfigFlag::PruneCompiledByteCodesWhileGC)) {
+        self->m_compiledByteCodeSizeBeforePruning = currentCodeSizeTotal;
+
+        // remove least recently used ByteCodeBlocks first until the total size goes under half of the limit
+        // we don't sort blocks here(GC is running). sizes are summed up by age bucket
+        // and then every block older than the selected threshold is removed
+        size_t sizeByAge[SCRIPT_FUNCTION_OBJECT_BYTECODE_AGE_BUCKET_COUNT] = {};
+        for (size_t i = 0; i < v.size(); i++) {
+            // ByteCodeBlock of top CodeBlock should be remove by Script class
+            if (v[i]->m_codeBlock->parent()) {
+                sizeByAge[byteCodeBlockAgeBucket(v[i], epoch)] += v[i]->memoryAllocatedSize();
+            }
+        }
+
+        size_t remainSize = currentCodeSizeTotal;
+        size_t targetSize = self->maxCompiledByteCodeSize() / 2;
+        size_t thresholdBucket = SCRIPT_FUNCTION_OBJECT_BYTECODE_AGE_BUCKET_COUNT;
+        while (thresholdBucket > 0 && remainSize > targetSize) {
+            thresholdBucket--;
+            remainSize -= std::min(sizeByAge[thresholdBucket], remainSize);
+        }
+
+        for (size_t i = 0; i < v.size(); i++) {
+            if (v[i]->m_codeBlock->parent() && byteCodeBlockAgeBucket(v[i], epoch) >= thresholdBucket) {
+                v[i]->m_codeBlock->setByteCodeBlock(nullptr);
+                v[i]->m_codeBlock->setByteCodeBlockPruned(true);
             }
         }
+
+        currentCodeSizeTotal = std::numeric_limits<size_t>::max();
+    }
+
+    for (size_t i = 0; i < v.size(); i++) {
+        v[i]->m_totalExecutionCount += v[i]->m_executionCount;
+        v[i]->m_executionCount = 0;
     }
 #endif
 }
@@ -228,6 +288,13 @@ void vmReclaimEndCallback(void* data)
 {
     VMInstance* self = (VMInstance*)data;
 
+    if (UNLIKELY(self->m_heapSoftLimit || self->m_heapHardLimit)) {
+        size_t usage = self->heapUsage();
+        if ((self->m_heapHardLimit && usage > self->m_heapHardLimit) || (self->m_heapSoftLimit && usage > self->m_heapSoftLimit && self->m_heapLimitCallback)) {
+            self->m_heapLimitExceeded = true;
+        }
+    }
+
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     auto currentTick = fastTickCount();
     if (currentTick - self->m_lastCompressibleStringsTestTime > ESCARGOT_COMPRESSIBLE_COMPRESS_GC_CHECK_INTERVAL) {
@@ -248,13 +315,19 @@ void vmReclaimEndCallback(void* data)
             currentCodeSizeTotal = 0;
             auto& v = self->compiledByteCodeBlocks();
             for (size_t i = 0; i < v.size(); i++) {
-                if (v[i]->m_codeBlock->parent()) {
+                // ByteCodeBlock is still alive(e.g. running now). restore it
+                if (v[i]->m_codeBlock->parent() && !v[i]->m_codeBlock->byteCodeBlock()) {
                     v[i]->m_codeBlock->setByteCodeBlock(v[i]);
-                    ASSERT(v[i]->m_codeBlock->byteCodeBlock() == v[i]);
+                    v[i]->m_codeBlock->setByteCodeBlockPruned(false);
                 }
+                ASSERT(!v[i]->m_codeBlock->parent() || v[i]->m_codeBlock->byteCodeBlock() == v[i]);
 
                 currentCodeSizeTotal += v[i]->memoryAllocatedSize();
             }
+
+            if (self->m_compiledByteCodeSizeBeforePruning > currentCodeSizeTotal) {
+                self->m_prunedByteCodeSize += self->m_compiledByteCodeSizeBeforePruning - currentCodeSizeTotal;
+            }
         }
     }
 
@@ -342,12 +415,23 @@ VMInstance::VMInstance(const char* locale, const char* timezone, const char* bas
     , m_lastGCMarkStartTickCount(fastTickCount())
     , m_compiledByteCodeSize(0)
     , m_maxCompiledByteCodeSize(SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX)
+    , m_byteCodeGCEpoch(0)
+    , m_compiledByteCodeSizeBeforePruning(0)
+    , m_prunedByteCodeSize(0)
+    , m_byteCodeRegenerationCount(0)
+    , m_byteCodeRegenerationTime(0)
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     , m_lastCompressibleStringsTestTime(0)
     , m_compressibleStringsUncomressedBufferSize(0)
 #endif
     , m_onVMInstanceDestroy(nullptr)
     , m_onVMInstanceDestroyData(nullptr)
+    , m_heapSoftLimit(0)
+    , m_heapHardLimit(0)
+    , m_heapLimitNotifiedGCCount(SIZE_MAX)
+    , m_heapLimitExceeded(false)
+    , m_heapLimitCallback(nullptr)
+    , m_heapLimitCallbackPublic(nullptr)
 #if defined(ENABLE_EXTENDED_API)
     , m_errorCreationCallback(nullptr)
     , m_errorCreationCallbackPublic(nullptr)
@@ -719,6 +803,7 @@ void VMInstance::clearCachesRelatedWithContext()
 #if defined(ENABLE_CODE_CACHE)
     // CodeCache should be cleared here because CodeCache holds a lock of cache directory
     // this lock should be released immediately (destructor may be called later)
+    m_codeCache->storeProfileData(this);
     m_codeCache->clear();
 #endif
     if (ThreadLocal::isInited()) {
@@ -730,12 +815,16 @@ void VMInstance::enterIdleMode()
 {
     m_inIdleMode = true;
 
+    // AST pools kept for the next parsing are not needed while idle
+    ThreadLocal::astAllocator()->releaseCachedPools();
+
     // user can call this function many times without many performance concern
     if (GC_get_bytes_since_gc() > 4096) {
         GC_gcollect_and_unmap();
         GC_gcollect_and_unmap();
         GC_gcollect_and_unmap();
     }
+    ArrayBufferAllocator::releasePooledBuffers();
 
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     if (m_config & (size_t)VMInstance::ConfigFlag::CompressCompressibleStringsEnterIdle) {
@@ -768,6 +857,168 @@ void VMInstance::enterIdleMode()
     m_inIdleMode = false;
 }
 
+VMInstance::IdleWorkResult VMInstance::performIdleWork(uint64_t idleTimeInMicroseconds)
+{
+    uint64_t deadline = longTickCount() + idleTimeInMicroseconds;
+    IdleWorkResult result = { false, 0, 0, 0, false };
+
+    m_inIdleMode = true;
+
+    // releasing cached pools is cheap
+    ThreadLocal::astAllocator()->releaseCachedPools();
+    ArrayBufferAllocator::releasePooledBuffers();
+
+    enum IdleWork {
+        GCWork,
+        CompressStringsWork,
+        UnloadStringsWork,
+        IdleWorkMax
+    };
+    // (expected bytes to be released, work)
+    std::pair<size_t, IdleWork> works[IdleWorkMax];
+    size_t workCount = 0;
+
+    size_t gcProfit = GC_get_bytes_since_gc();
+    if (m_config & (size_t)VMInstance::ConfigFlag::PruneCompiledByteCodesEnterIdle) {
+        gcProfit += m_compiledByteCodeSize;
+    }
+    // same threshold with enterIdleMode. incremental gc may have a collection in progress
+    bool needsFullGC = gcProfit > 4096;
+    if (needsFullGC || GC_is_incremental_mode()) {
+        works[workCount++] = std::make_pair(gcProfit, GCWork);
+    }
+
+#if defined(ENABLE_COMPRESSIBLE_STRING)
+    if ((m_config & (size_t)VMInstance::ConfigFlag::CompressCompressibleStringsEnterIdle) && m_compressibleStringsUncomressedBufferSize) {
+        works[workCount++] = std::make_pair(m_compressibleStringsUncomressedBufferSize, CompressStringsWork);
+    }
+#endif
+
+#if defined(ENABLE_RELOADABLE_STRING)
+    if (m_config & (size_t)VMInstance::ConfigFlag::UnloadReloadableStringsEnterIdle) {
+        size_t loadedSize = 0;
+        for (size_t i = 0; i < m_reloadableStrings.size(); i++) {
+            loadedSize += m_reloadableStrings[i]->unloadedBufferSize();
+        }
+        if (loadedSize) {
+            works[workCount++] = std::make_pair(loadedSize, UnloadStringsWork);
+        }
+    }
+#endif
+
+    std::sort(works, works + workCount, [](const std::pair<size_t, IdleWork>& a, const std::pair<size_t, IdleWork>& b) -> bool {
+        return a.first > b.first;
+    });
+
+    for (size_t i = 0; i < workCount; i++) {
+        if (longTickCount() >= deadline) {
+            result.hasRemainingWork = true;
+            break;
+        }
+
+        bool finished = true;
+        switch (works[i].second) {
+        case GCWork:
+            finished = performIdleGC(deadline, needsFullGC, result);
+            break;
+#if defined(ENABLE_COMPRESSIBLE_STRING)
+        case CompressStringsWork:
+            finished = compressStringsInIdle(deadline, result);
+            break;
+#endif
+#if defined(ENABLE_RELOADABLE_STRING)
+        case UnloadStringsWork:
+            finished = unloadStringsInIdle(deadline, result);
+            break;
+#endif
+        default:
+            RELEASE_ASSERT_NOT_REACHED();
+        }
+        result.hasRemainingWork |= !finished;
+    }
+
+    m_inIdleMode = false;
+    return result;
+}
+
+bool VMInstance::performIdleGC(uint64_t deadline, bool needsFullGC, IdleWorkResult& result)
+{
+    if (GC_is_incremental_mode()) {
+        // incremental gc can be split into small steps
+        while (GC_collect_a_little()) {
+            result.gcSliceCount++;
+            if (longTickCount() >= deadline) {
+                return false;
+            }
+        }
+        if (result.gcSliceCount || !needsFullGC) {
+            return true;
+        }
+    }
+
+    // full gc cannot be split. do it only if the last pause fits in the remaining time
+    if (longTickCount() + ThreadLocal::gcStatistics().lastPauseTime() > deadline) {
+        return false;
+    }
+    GC_gcollect_and_unmap();
+    result.gcPerformed = true;
+    return true;
+}
+
+#if defined(ENABLE_COMPRESSIBLE_STRING)
+bool VMInstance::compressStringsInIdle(uint64_t deadline, IdleWorkResult& result)
+{
+    std::vector<CompressibleString*> candidates;
+    for (size_t i = 0; i < m_compressibleStrings.size(); i++) {
+        if (!m_compressibleStrings[i]->isCompressed()) {
+            candidates.push_back(m_compressibleStrings[i]);
+        }
+    }
+
+    // compress bigger strings first
+    std::sort(candidates.begin(), candidates.end(), [](CompressibleString* a, CompressibleString* b) -> bool {
+        return a->decomressedBufferSize() > b->decomressedBufferSize();
+    });
+
+    for (size_t i = 0; i < candidates.size(); i++) {
+        if (longTickCount() >= deadline) {
+            return false;
+        }
+        if (candidates[i]->compress()) {
+            result.compressedStringCount++;
+        }
+    }
+    return true;
+}
+#endif
+
+#if defined(ENABLE_RELOADABLE_STRING)
+bool VMInstance::unloadStringsInIdle(uint64_t deadline, IdleWorkResult& result)
+{
+    std::vector<ReloadableString*> candidates;
+    for (size_t i = 0; i < m_reloadableStrings.size(); i++) {
+        if (!m_reloadableStrings[i]->isUnloaded()) {
+            candidates.push_back(m_reloadableStrings[i]);
+        }
+    }
+
+    // unload bigger strings first
+    std::sort(candidates.begin(), candidates.end(), [](ReloadableString* a, ReloadableString* b) -> bool {
+        return a->unloadedBufferSize() > b->unloadedBufferSize();
+    });
+
+    for (size_t i = 0; i < candidates.size(); i++) {
+        if (longTickCount() >= deadline) {
+            return false;
+        }
+        if (candidates[i]->unload()) {
+            result.unloadedStringCount++;
+        }
+    }
+    return true;
+}
+#endif
+
 void VMInstance::somePrototypeObjectDefineIndexedProperty(ExecutionState& state)
 {
     m_didSomePrototypeObjectDefineIndexedProperty = true;
@@ -800,6 +1051,34 @@ bool VMInstance::hasPendingJob()
     return m_jobQueue->hasNextJob();
 }
 
+void VMInstance::checkHeapLimitSlowCase(ExecutionState& state, size_t additionalBytes)
+{
+    size_t usage = heapUsage() + additionalBytes;
+    if (m_heapSoftLimit && usage > m_heapSoftLimit && m_heapLimitCallback) {
+        size_t gcCount = ThreadLocal::gcStatistics().gcCount();
+        if (m_heapLimitNotifiedGCCount != gcCount) {
+            // update count first to prevent recursive call from callback
+            m_heapLimitNotifiedGCCount = gcCount;
+            m_heapLimitCallback(this, usage, m_heapLimitCallbackPublic);
+            usage = heapUsage() + additionalBytes;
+        }
+    }
+
+    if (m_heapHardLimit && usage > m_heapHardLimit) {
+        // there may be garbage not swept yet
+        GC_gcollect_and_unmap();
+        GC_invoke_finalizers();
+        usage = heapUsage() + additionalBytes;
+        if (usage > m_heapHardLimit) {
+            m_heapLimitExceeded = false;
+            ErrorObject::throwBuiltinError(state, ErrorCode::RangeError, ErrorObject::Messages::HeapLimitExceeded);
+        }
+    }
+
+    // the flag could be set again by the gc above
+    m_heapLimitExceeded = false;
+}
+
 SandBox::SandBoxResult VMInstance::executePendingJob()
 {
     return m_jobQueue->nextJob()->run();
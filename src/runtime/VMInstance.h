@@ -130,6 +130,18 @@ public:
     }
 
     void enterIdleMode();
+
+    struct IdleWorkResult {
+        bool gcPerformed; // full gc which also prunes bytecodes(if enabled)
+        size_t gcSliceCount; // steps of incremental gc
+        size_t compressedStringCount;
+        size_t unloadedStringCount;
+        bool hasRemainingWork; // time was over before finishing every work
+    };
+    // do the work of enterIdleMode in the given time
+    // work which is expected to reclaim more memory runs first. remaining work continues on the next call
+    IdleWorkResult performIdleWork(uint64_t idleTimeInMicroseconds);
+
     void clearCachesRelatedWithContext();
 
     const GlobalSymbols& globalSymbols()
@@ -237,6 +249,33 @@ public:
         m_maxCompiledByteCodeSize = s;
     }
 
+    size_t byteCodeGCEpoch()
+    {
+        return m_byteCodeGCEpoch;
+    }
+
+    size_t prunedByteCodeSize()
+    {
+        return m_prunedByteCodeSize;
+    }
+
+    size_t byteCodeRegenerationCount()
+    {
+        return m_byteCodeRegenerationCount;
+    }
+
+    // in microseconds
+    uint64_t byteCodeRegenerationTime()
+    {
+        return m_byteCodeRegenerationTime;
+    }
+
+    void recordByteCodeRegeneration(uint64_t elapsedTime)
+    {
+        m_byteCodeRegenerationCount++;
+        m_byteCodeRegenerationTime += elapsedTime;
+    }
+
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     std::vector<CompressibleString*>& compressibleStrings()
     {
@@ -272,6 +311,41 @@ public:
         m_onVMInstanceDestroyData = data;
     }
 
+    // heap quota
+    // usage is gc heap of the current thread + ArrayBuffer data allocated on the current thread
+    // soft limit calls the callback once per gc cycle, hard limit throws RangeError
+    // limits are checked when ArrayBuffer is allocated or Script is executed
+    // and at the end of each gc which makes the interpreter check them on the next loop back-edge
+    typedef void (*HeapLimitCallback)(VMInstance* instance, size_t usage, void* callback);
+    void setHeapLimit(size_t softLimit, size_t hardLimit, HeapLimitCallback callback, void* callbackPublic)
+    {
+        ASSERT(!softLimit || !hardLimit || softLimit <= hardLimit);
+        m_heapSoftLimit = softLimit;
+        m_heapHardLimit = hardLimit;
+        m_heapLimitCallback = callback;
+        m_heapLimitCallbackPublic = callbackPublic;
+    }
+
+    size_t heapUsage()
+    {
+        return GCStatistics::currentHeapUsage() + ThreadLocal::arrayBufferBytes();
+    }
+
+    void checkHeapLimit(ExecutionState& state, size_t additionalBytes = 0)
+    {
+        if (UNLIKELY(m_heapSoftLimit || m_heapHardLimit)) {
+            checkHeapLimitSlowCase(state, additionalBytes);
+        }
+    }
+
+    // called by interpreter on loop back-edges
+    void checkHeapLimitIfExceeded(ExecutionState& state)
+    {
+        if (UNLIKELY(m_heapLimitExceeded)) {
+            checkHeapLimitSlowCase(state, 0);
+        }
+    }
+
 #if defined(ENABLE_EXTENDED_API)
     bool isErrorCreationCallbackRegistered()
     {
@@ -456,6 +530,13 @@ private:
     std::vector<ByteCodeBlock*> m_compiledByteCodeBlocks;
     size_t m_compiledByteCodeSize;
     size_t m_maxCompiledByteCodeSize;
+    // increased on every GC. used for finding least recently used ByteCodeBlocks
+    size_t m_byteCodeGCEpoch;
+    size_t m_compiledByteCodeSizeBeforePruning;
+    // statistics of bytecode pruning
+    size_t m_prunedByteCodeSize;
+    size_t m_byteCodeRegenerationCount;
+    uint64_t m_byteCodeRegenerationTime;
 
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     uint64_t m_lastCompressibleStringsTestTime;
@@ -472,6 +553,25 @@ private:
     void (*m_onVMInstanceDestroy)(VMInstance* instance, void* data);
     void* m_onVMInstanceDestroyData;
 
+    size_t m_heapSoftLimit;
+    size_t m_heapHardLimit;
+    // gc count when soft limit callback was called last time
+    size_t m_heapLimitNotifiedGCCount;
+    // set by gc when usage exceeds the limit. we cannot throw inside of gc
+    bool m_heapLimitExceeded;
+    HeapLimitCallback m_heapLimitCallback;
+    void* m_heapLimitCallbackPublic;
+    NEVER_INLINE void checkHeapLimitSlowCase(ExecutionState& state, size_t additionalBytes);
+
+    // each returns true if the work is finished before the deadline
+    bool performIdleGC(uint64_t deadline, bool needsFullGC, IdleWorkResult& result);
+#if defined(ENABLE_COMPRESSIBLE_STRING)
+    bool compressStringsInIdle(uint64_t deadline, IdleWorkResult& result);
+#endif
+#if defined(ENABLE_RELOADABLE_STRING)
+    bool unloadStringsInIdle(uint64_t deadline, IdleWorkResult& result);
+#endif
+
 #if defined(ENABLE_EXTENDED_API)
     void (*m_errorCreationCallback)(ExecutionState& state, ErrorObject* err, void* cb);
     void* m_errorCreationCallbackPublic;
@@ -1037,6 +1037,31 @@ int main(int argc, char* argv[])
 #endif
 
     bool waitBeforeExit = false;
+    const char* heapSnapshotPath = nullptr;
+    bool dumpGCStats = false;
+
+    // collector options should be applied before initializing Globals
+    for (int i = 1; i < argc; i++) {
+        if (strstr(argv[i], "--gc-markers=") == argv[i]) {
+            const char* value = argv[i] + sizeof("--gc-markers=") - 1;
+            char* end = nullptr;
+            long markerCount = strtol(value, &end, 10);
+            if (end == value || *end != '\0' || markerCount <= 0) {
+                fprintf(stderr, "Invalid value of --gc-markers `%s`, it should be a positive number of threads\n", value);
+                return 3;
+            }
+            Memory::setGCMarkerThreadCount(static_cast<size_t>(markerCount));
+        } else if (strstr(argv[i], "--gc-incremental=") == argv[i]) {
+            const char* value = argv[i] + sizeof("--gc-incremental=") - 1;
+            char* end = nullptr;
+            long pauseTarget = strtol(value, &end, 10);
+            if (end == value || *end != '\0' || pauseTarget <= 0) {
+                fprintf(stderr, "Invalid value of --gc-incremental `%s`, it should be a positive number of milliseconds\n", value);
+                return 3;
+            }
+            Memory::setGCIncrementalPauseTarget(static_cast<size_t>(pauseTarget));
+        }
+    }
 
     ShellPlatform* platform = new ShellPlatform();
     Globals::initialize(platform);
@@ -1100,6 +1125,17 @@ int main(int argc, char* argv[])
                     }
                     continue;
                 }
+                if (strstr(argv[i], "--heap-snapshot=") == argv[i]) {
+                    heapSnapshotPath = argv[i] + sizeof("--heap-snapshot=") - 1;
+                    continue;
+                }
+                if (strstr(argv[i], "--gc-markers=") == argv[i] || strstr(argv[i], "--gc-incremental=") == argv[i]) {
+                    continue;
+                }
+                if (strcmp(argv[i], "--gc-stats") == 0) {
+                    dumpGCStats = true;
+                    continue;
+                }
                 if (strcmp(argv[i], "--wait-before-exit") == 0) {
                     waitBeforeExit = true;
                     continue;
@@ -1169,6 +1205,22 @@ int main(int argc, char* argv[])
         evalScript(context, str, StringRef::emptyString(), true, false);
     }
 
+    if (heapSnapshotPath && !instance->writeHeapSnapshot(heapSnapshotPath)) {
+        fprintf(stderr, "Cannot write heap snapshot to %s\n", heapSnapshotPath);
+    }
+
+    if (dumpGCStats) {
+        Memory::GCStatistics stat = Memory::gcStatistics();
+        printf("gc count %zu\n", stat.gcCount);
+        printf("gc pause total %.3f ms, max %.3f ms, p50 %.3f ms, p99 %.3f ms\n",
+               stat.totalPauseTime / 1000.0, stat.maxPauseTime / 1000.0, stat.pauseTimeP50 / 1000.0, stat.pauseTimeP99 / 1000.0);
+        printf("last gc mark %.3f ms, sweep %.3f ms, pause %.3f ms\n",
+               stat.lastMarkTime / 1000.0, stat.lastSweepTime / 1000.0, stat.lastPauseTime / 1000.0);
+        printf("last gc allocated %f KiB, heap usage %f KiB -> %f KiB, reclaimed %f KiB\n",
+               stat.lastAllocatedBytes / 1024.f, stat.lastHeapUsageBefore / 1024.f, stat.lastHeapUsageAfter / 1024.f, stat.lastReclaimedBytes / 1024.f);
+        printf("total reclaimed %f KiB\n", stat.totalReclaimedBytes / 1024.f);
+    }
+
 #if defined(ESCARGOT_ENABLE_TEST)
     while (true) {
         bool everyThreadIsEnded = true;
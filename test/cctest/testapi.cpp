@@ -23,6 +23,8 @@ using namespace Escargot;
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <thread>
 #include <vector>
 
 static bool stringEndsWith(const std::string& str, const std::string& suffix)
@@ -2444,6 +2446,80 @@ TEST(IteratorObject, GenericIterator)
                StringRef::createFromASCII("test.js"), false);
 }
 
+TEST(IteratorObject, ArrayIteratorNextReplaced)
+{
+    // %ArrayIteratorPrototype%.next replaced before GetIterator is observable
+    // but replacing it after GetIterator should not affect the iteration
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    (function() {
+        var r = [];
+        var proto = Object.getPrototypeOf([][Symbol.iterator]());
+        var origNext = proto.next;
+        var calls = 0;
+        var counting = function() { calls++; return origNext.call(this); };
+        var fake = function() { calls++; return { value: 'fake', done: false }; };
+
+        // replaced before GetIterator, so every step is observable
+        proto.next = counting;
+        for (var v of [1, 2]) {}
+        var [a, b] = [3, 4];
+        var s = [...[5, 6]];
+        proto.next = origNext;
+        r.push(calls, a + b, s.join(''));
+
+        // replaced after GetIterator, so the captured next is used
+        calls = 0;
+        var seen = [];
+        for (var v of [1, 2, 3]) { proto.next = fake; seen.push(v); }
+        proto.next = origNext;
+        var [c = (proto.next = fake, 7), d] = [undefined, 8];
+        proto.next = origNext;
+        var spreadSource = [1, 2, 3];
+        Object.defineProperty(spreadSource, 1, { get: function() { proto.next = fake; return 20; } });
+        var t = [...spreadSource];
+        proto.next = origNext;
+        r.push(calls, seen.join(''), c, d, t.join(''));
+
+        // detached typed array
+        var ta = new Uint8Array(4);
+        var count = 0;
+        try { for (var v of ta) { count++; ta.buffer.transfer(); } } catch (e) { r.push(e instanceof TypeError, count); }
+        return r.join();
+    })()
+)"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "8,7,56,0,123,7,8,1203,true,1");
+}
+
+TEST(IteratorObject, ArrayIterationAllocation)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var iterTestArray = [];
+    for (var i = 0; i < 100000; i++) { iterTestArray.push(i); }
+    var iterTestProto = Object.getPrototypeOf([][Symbol.iterator]());
+    var iterTestNext = iterTestProto.next;
+    var iterTestWrappedNext = function() { return iterTestNext.call(this); };
+)"),
+               StringRef::createFromASCII("test.js"), false);
+
+    auto src = StringRef::createFromASCII("(function() { var n = 0; for (var v of iterTestArray) { n++; } return n; })()");
+
+    // original next does not allocate {value, done} object on each step
+    size_t before = Memory::totalSize();
+    auto s = evalScript(g_context.get(), src, StringRef::createFromASCII("test.js"), false);
+    size_t fastPathBytes = Memory::totalSize() - before;
+    EXPECT_EQ(s, "100000");
+
+    evalScript(g_context.get(), StringRef::createFromASCII("iterTestProto.next = iterTestWrappedNext"), StringRef::createFromASCII("test.js"), false);
+    before = Memory::totalSize();
+    s = evalScript(g_context.get(), src, StringRef::createFromASCII("test.js"), false);
+    size_t slowPathBytes = Memory::totalSize() - before;
+    EXPECT_EQ(s, "100000");
+    evalScript(g_context.get(), StringRef::createFromASCII("iterTestProto.next = iterTestNext; iterTestArray = undefined"), StringRef::createFromASCII("test.js"), false);
+
+    EXPECT_LT(fastPathBytes * 4, slowPathBytes);
+}
+
 TEST(ReloadableString, Basic)
 {
     char reloadableStringTestSource[] = "let x = 'test String'";
@@ -2499,6 +2575,454 @@ TEST(ReloadableString, Basic)
         return ValueRef::createUndefined(); }, string, &d);
 }
 
+TEST(VMInstance, PerformIdleWork)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII("var idleWorkTest = []; for (var i = 0; i < 1000; i++) idleWorkTest.push({ i: i }); idleWorkTest = undefined;"), StringRef::createFromASCII("test.js"), false);
+
+    // no time to do anything
+    VMInstanceRef::IdleWorkResult result = g_instance->performIdleWork(0);
+    EXPECT_FALSE(result.gcPerformed);
+    EXPECT_TRUE(result.hasRemainingWork);
+
+    result = g_instance->performIdleWork(10 * 1000 * 1000);
+    EXPECT_TRUE(result.gcPerformed);
+    EXPECT_FALSE(result.hasRemainingWork);
+
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII("idleWorkTest"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "undefined");
+}
+
+TEST(VMInstance, ByteCodePruningStatistics)
+{
+    // allocate some garbage so that enterIdleMode surely runs GC
+    evalScript(g_context.get(), StringRef::createFromASCII("function byteCodePruningTest() { return 1; } byteCodePruningTest(); for (var i = 0; i < 1000; i++) { [i, i + 1]; }"), StringRef::createFromASCII("test.js"), false);
+
+    size_t prunedSize = g_instance->prunedByteCodeSize();
+    size_t regenerationCount = g_instance->byteCodeRegenerationCount();
+    g_instance->enterIdleMode();
+    EXPECT_GT(g_instance->prunedByteCodeSize(), prunedSize);
+
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII("byteCodePruningTest()"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "1");
+    EXPECT_GT(g_instance->byteCodeRegenerationCount(), regenerationCount);
+    EXPECT_TRUE(g_instance->compiledByteCodeSize() > 0);
+}
+
+TEST(VMInstance, HeapSnapshot)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII("var heapSnapshotTest = [1, 2, 3];"), StringRef::createFromASCII("test.js"), false);
+
+    const char* path = "escargot_test.heapsnapshot";
+    EXPECT_TRUE(g_instance->writeHeapSnapshot(path));
+
+    FILE* fp = fopen(path, "r");
+    ASSERT_TRUE(fp != nullptr);
+    std::string content;
+    char buf[4096];
+    size_t len;
+    while ((len = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        content.append(buf, len);
+    }
+    fclose(fp);
+    remove(path);
+
+    EXPECT_EQ(content.find("{\"snapshot\":{\"meta\":"), 0u);
+    EXPECT_NE(content.find("\"ArrayObject\""), std::string::npos);
+}
+
+TEST(Memory, ArrayBufferData)
+{
+    const size_t sizes[] = { 0, 10, 4096, 5000, 1024 * 1024 };
+    for (size_t size : sizes) {
+        for (size_t i = 0; i < 2; i++) {
+            uint8_t* buffer = static_cast<uint8_t*>(Memory::allocateArrayBufferData(size));
+            ASSERT_TRUE(buffer != nullptr);
+            EXPECT_EQ(std::count(buffer, buffer + size, 0), (ptrdiff_t)size);
+            memset(buffer, 0xff, size);
+
+            // grown area should be zero-filled
+            buffer = static_cast<uint8_t*>(Memory::reallocateArrayBufferData(buffer, size, size * 2 + 1));
+            ASSERT_TRUE(buffer != nullptr);
+            EXPECT_EQ(std::count(buffer, buffer + size, 0xff), (ptrdiff_t)size);
+            EXPECT_EQ(std::count(buffer + size, buffer + size * 2 + 1, 0), (ptrdiff_t)(size + 1));
+            // freed buffer is reused in the next round and it should be cleared again
+            Memory::freeArrayBufferData(buffer, size * 2 + 1);
+        }
+    }
+}
+
+static size_t g_heapLimitCallbackCount;
+
+TEST(VMInstance, HeapLimit)
+{
+    g_heapLimitCallbackCount = 0;
+    size_t usage = g_instance->heapUsage();
+    g_instance->setHeapLimit(1, usage + 16 * 1024 * 1024, [](VMInstanceRef*, size_t) {
+        g_heapLimitCallbackCount++;
+    });
+
+    std::string result = evalScript(g_context.get(), StringRef::createFromASCII("try { new ArrayBuffer(64 * 1024 * 1024); false; } catch (e) { e instanceof RangeError; }"), StringRef::createFromASCII("test.js"), false);
+    g_instance->setHeapLimit(0, 0);
+
+    EXPECT_EQ(result, "true");
+    EXPECT_GE(g_heapLimitCallbackCount, 1u);
+}
+
+TEST(VMInstance, HeapLimitInLoop)
+{
+    // a loop which allocates only small objects is stopped on its back-edge after gc
+    size_t usage = g_instance->heapUsage();
+    g_instance->setHeapLimit(0, usage + 32 * 1024 * 1024);
+
+    std::string result = evalScript(g_context.get(), StringRef::createFromASCII("var heapLimitTest = []; try { while (true) { heapLimitTest.push({}); } } catch (e) { heapLimitTest = null; e instanceof RangeError; }"), StringRef::createFromASCII("test.js"), false);
+    g_instance->setHeapLimit(0, 0);
+
+    EXPECT_EQ(result, "true");
+}
+
+TEST(Memory, GCStatistics)
+{
+    Memory::GCStatistics before = Memory::gcStatistics();
+    Memory::gc();
+    Memory::GCStatistics after = Memory::gcStatistics();
+
+    EXPECT_GT(after.gcCount, before.gcCount);
+    EXPECT_GE(after.totalPauseTime, before.totalPauseTime);
+    EXPECT_GE(after.maxPauseTime, after.lastPauseTime);
+    EXPECT_GE(after.pauseTimeP99, after.pauseTimeP50);
+    EXPECT_GE(after.totalReclaimedBytes, after.lastReclaimedBytes);
+}
+
+TEST(Memory, IncrementalGCPause)
+{
+    if (!Globals::supportsThreading()) {
+        return;
+    }
+
+    // collector options are applied when the heap of a thread is initialized
+    // so run the test on a new thread with its own heap
+    std::thread worker([]() {
+        const size_t pauseTarget = 20; // milliseconds
+        Memory::setGCIncrementalPauseTarget(pauseTarget);
+        Globals::initializeThread();
+
+        PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create();
+        PersistentRefHolder<ContextRef> context = createEscargotContext(instance.get());
+
+        size_t gcCount = Memory::gcStatistics().gcCount;
+        // keep a part of allocated objects alive so that each collection has something to mark
+        auto s = evalScript(context.get(), StringRef::createFromASCII(R"(
+        var live = [];
+        for (var i = 0; i < 400000; i++) {
+            var o = { index: i, name: 'item' + i, children: [i, i + 1] };
+            if (i % 8 == 0) live.push(o);
+        }
+        live.length
+)"),
+                            StringRef::createFromASCII("test.js"), false);
+        EXPECT_EQ(s, "50000");
+
+        Memory::GCStatistics stat = Memory::gcStatistics();
+        EXPECT_GT(stat.gcCount, gcCount);
+        // pause times are in microseconds
+        EXPECT_LE(stat.pauseTimeP50, pauseTarget * 1000);
+        EXPECT_GE(stat.maxPauseTime, stat.pauseTimeP50);
+
+        context.release();
+        instance.release();
+
+        Globals::finalizeThread();
+        Memory::setGCIncrementalPauseTarget(0);
+    });
+    worker.join();
+}
+
+TEST(Memory, ObjectStructureMemoryUsage)
+{
+    // records with optional fields make branches in transition tree
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII("var structureTestRecords = []; for (var i = 0; i < 64; i++) { var r = { id: i, name: 'n' + i }; if (i % 2) r.a = i; if (i % 3) r.b = i; if (i % 5) r.c = i; structureTestRecords.push(r); }"
+                                                                  "structureTestRecords[61].id + structureTestRecords[61].a + structureTestRecords[61].b + structureTestRecords[61].c + structureTestRecords[31].b"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "275");
+
+    Memory::ObjectStructureMemoryUsage usage = Memory::objectStructureMemoryUsage();
+    EXPECT_GT(usage.propertyTableCount, 0u);
+    EXPECT_GE(usage.propertyTableBytes, usage.propertyTableCount);
+    EXPECT_GT(usage.transitionTableCount, 0u);
+    EXPECT_GE(usage.transitionTableBytes, usage.transitionTableCount);
+
+    evalScript(g_context.get(), StringRef::createFromASCII("structureTestRecords = undefined"), StringRef::createFromASCII("test.js"), false);
+}
+
+static size_t transitionTableCountAfterDrop(ContextRef* context, const char* source)
+{
+    evalScript(context, StringRef::createFromASCII(source, strlen(source)), StringRef::createFromASCII("test.js"), false);
+    // clear stack
+    Evaluator::execute(context, [](ExecutionStateRef* state, StringRef* s) -> ValueRef* { return ValueRef::create(100); }, StringRef::createFromUTF8("qwer"));
+    for (size_t i = 0; i < 100; i++) {
+        PersistentRefHolder<StringRef> dummy = StringRef::createFromUTF8("asdf");
+    }
+    Memory::gc();
+    Memory::gc();
+    Memory::gc();
+    return Memory::objectStructureMemoryUsage().transitionTableCount;
+}
+
+TEST(Memory, ObjectStructureTransitionCollected)
+{
+    PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create();
+    PersistentRefHolder<ContextRef> context = createEscargotContext(instance.get());
+
+    // {} -> {shapeTestRoot} -> {shapeTestRoot, shapeTestA}
+    //                       -> {shapeTestRoot, shapeTestB0..7} -> {shapeTestRoot, shapeTestB0..7, shapeTestC}
+    // builtins are used to add properties not to leave inline caches of the structures
+    auto s = evalScript(context.get(), StringRef::createFromASCII(R"(
+    var shapeTestKeep, shapeTestDrop;
+    function shapeTestBuild(names) { var o = {}; for (var i = 0; i < names.length; i++) { Reflect.set(o, names[i], i + 1); } return o; }
+    (function() {
+        shapeTestKeep = shapeTestBuild(['shapeTestRoot', 'shapeTestA']);
+        shapeTestDrop = [];
+        for (var k = 0; k < 8; k++) {
+            shapeTestDrop.push(shapeTestBuild(['shapeTestRoot', 'shapeTestB' + k, 'shapeTestC']));
+        }
+        return shapeTestKeep.shapeTestRoot + shapeTestKeep.shapeTestA + shapeTestDrop.length;
+    })()
+)"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "11");
+
+    size_t before = transitionTableCountAfterDrop(context.get(), "undefined");
+    // structures without live descendant are collected with their transition tables
+    size_t afterDrop = transitionTableCountAfterDrop(context.get(), "shapeTestDrop = undefined");
+    EXPECT_EQ(before - afterDrop, 8u);
+
+    // {shapeTestRoot} has no object but survives because {shapeTestRoot, shapeTestA} is alive
+    s = evalScript(context.get(), StringRef::createFromASCII("[shapeTestKeep.shapeTestRoot, shapeTestKeep.shapeTestA, Object.keys(shapeTestKeep), shapeTestBuild(['shapeTestRoot', 'shapeTestB0']).shapeTestB0].join()"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "1,2,shapeTestRoot,shapeTestA,2");
+
+    // {shapeTestRoot} goes away with its last descendant
+    size_t afterKeepDrop = transitionTableCountAfterDrop(context.get(), "shapeTestKeep = undefined");
+    EXPECT_EQ(afterDrop - afterKeepDrop, 1u);
+
+    context.release();
+    instance.release();
+}
+
+TEST(Script, PrecompileFunctions)
+{
+    // use own VMInstance. the result depends on the size of bytecode compiled in the VMInstance
+    PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create();
+    PersistentRefHolder<ContextRef> context = createEscargotContext(instance.get());
+
+    auto result = context->scriptParser()->initializeScript(StringRef::createFromASCII("function precompileA() { function precompileB() { return 1; } return precompileB(); } function precompileC() { return 2; } precompileA() + precompileC();"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_TRUE(result.isSuccessful());
+
+    auto r = Evaluator::execute(context.get(), [](ExecutionStateRef* state, ScriptRef* script) -> ValueRef* {
+        // precompileA, precompileB and precompileC
+        EXPECT_EQ(script->precompileFunctions(state), 3u);
+        // every function has its bytecode now
+        EXPECT_EQ(script->precompileFunctions(state), 0u);
+        return script->execute(state);
+    },
+                                result.script.get());
+    EXPECT_TRUE(r.isSuccessful());
+    EXPECT_TRUE(r.result->isNumber() && r.result->asNumber() == 3);
+
+    // function object created after precompiling uses simple function call path like lazily compiled one
+    // function which cannot use it keeps the generic path
+    auto simpleResult = context->scriptParser()->initializeScript(StringRef::createFromASCII("function precompileSimple(a) { return a + 1; } function precompileClosure(a) { return () => a + 2; } [precompileSimple, precompileClosure]"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_TRUE(simpleResult.isSuccessful());
+
+    auto simpleRun = Evaluator::execute(context.get(), [](ExecutionStateRef* state, ScriptRef* script) -> ValueRef* {
+        EXPECT_EQ(script->precompileFunctions(state), 3u);
+        ObjectRef* functions = script->execute(state)->asObject();
+        FunctionObjectRef* simple = functions->get(state, ValueRef::create(0))->asFunctionObject();
+        FunctionObjectRef* closure = functions->get(state, ValueRef::create(1))->asFunctionObject();
+        ValueRef* argv[1] = { ValueRef::create(1) };
+        EXPECT_TRUE(simple->isSimpleScriptFunction());
+        EXPECT_EQ(simple->call(state, ValueRef::createUndefined(), 1, argv)->asNumber(), 2);
+        EXPECT_FALSE(closure->isSimpleScriptFunction());
+        FunctionObjectRef* inner = closure->call(state, ValueRef::createUndefined(), 1, argv)->asFunctionObject();
+        EXPECT_EQ(inner->call(state, ValueRef::createUndefined(), 0, nullptr)->asNumber(), 3);
+        EXPECT_FALSE(closure->isSimpleScriptFunction());
+        return ValueRef::createUndefined();
+    },
+                                        simpleResult.script.get());
+    EXPECT_TRUE(simpleRun.isSuccessful());
+
+    context.release();
+    instance.release();
+}
+
+TEST(ScriptParser, ParseStatistics)
+{
+    size_t programParseCount = g_context->scriptParser()->programParseCount();
+    size_t functionParseCount = g_context->scriptParser()->functionParseCount();
+
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII("function parseStatisticsTest(a) { var f = (x, y = 1) => x + y; return f(a); } parseStatisticsTest(1)"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "2");
+    EXPECT_EQ(g_context->scriptParser()->programParseCount(), programParseCount + 1);
+    // parseStatisticsTest and the arrow function are parsed again on their first call
+    EXPECT_EQ(g_context->scriptParser()->functionParseCount(), functionParseCount + 2);
+}
+
+TEST(ScriptParser, ASTArenaPeakSize)
+{
+    // a source small enough not to be code cached but needs more than the first AST pool
+    std::string src = "var astArenaTest = [";
+    for (int i = 0; i < 500; i++) {
+        src += "[1, 2],";
+    }
+    src += "]; astArenaTest.length";
+
+    // reading the peak size resets it, so each read measures only the parsing after the previous one
+    g_context->scriptParser()->astArenaPeakSize();
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII("1 + 1"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "2");
+    EXPECT_EQ(g_context->scriptParser()->astArenaPeakSize(), static_cast<size_t>(1024 * 4));
+
+    s = evalScript(g_context.get(), StringRef::createFromASCII(src.data(), src.length()), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "500");
+    EXPECT_GT(g_context->scriptParser()->astArenaPeakSize(), static_cast<size_t>(1024 * 4));
+}
+
+TEST(EvalScript, BlockScopedClosure)
+{
+    // closures capture let/const of several nested blocks and each loop iteration has its own binding
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    (function() {
+        const fns = [];
+        let outer = 1;
+        for (let i = 0; i < 3; i++) {
+            const a = i * 10;
+            {
+                let b = a + 1;
+                {
+                    const c = b + 1;
+                    fns.push(function() { return outer + i + a + b + c; });
+                    fns.push(function(v) { b = v; return b + c; });
+                }
+            }
+        }
+        outer = 100;
+        var r = [];
+        for (var f = 0; f < fns.length; f += 2) {
+            r.push(fns[f]());
+            r.push(fns[f + 1](f));
+            r.push(fns[f]());
+        }
+        return r.join();
+    })()
+)"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "103,2,102,134,14,125,165,26,148");
+
+    s = evalScript(g_context.get(), StringRef::createFromASCII("(function() { { let x = 1; { { return (() => { try { y; } catch (e) { return x + (e instanceof ReferenceError); } let y; })(); } } } })()"),
+                   StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "2");
+}
+
+TEST(EvalScript, GeneratorAndAsyncResume)
+{
+    // yield and await on top of function body resume without resume code
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var resumeTestResult = [];
+    function* resumeTestGen() { var x = yield 1; var y = yield x + 1; return y * 2; }
+    var it = resumeTestGen();
+    resumeTestResult.push(it.next().value, it.next(10).value, it.next(5).value, it.next().done, it.next(1).value);
+    it = resumeTestGen();
+    it.next();
+    try { it.throw(new Error('gen')); } catch (e) { resumeTestResult.push(e.message); }
+    resumeTestResult.push(it.next().done);
+    it = resumeTestGen();
+    it.next();
+    resumeTestResult.push(it.return(7).value, it.next().done);
+    resumeTestResult.join();
+)"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "1,11,10,true,,gen,true,7,true");
+
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var resumeTestLog = [];
+    async function resumeTestAsync(p) { var a = await p; var b = await (a + 1); return b * 2; }
+    resumeTestAsync(1).then(function(v) { resumeTestLog.push(v); });
+    async function resumeTestAsyncThrow() { await 0; throw new Error('async'); }
+    resumeTestAsyncThrow().catch(function(e) { resumeTestLog.push(e.message); });
+    async function resumeTestAsyncReject() { var v = await Promise.reject(4); return v; }
+    resumeTestAsyncReject().catch(function(e) { resumeTestLog.push(e); });
+    async function* resumeTestAsyncGen() { var x = yield 1; await 0; return x; }
+    var ag = resumeTestAsyncGen();
+    ag.next().then(function(v) { resumeTestLog.push('a' + v.value); });
+    ag.next(2).then(function(v) { resumeTestLog.push('b' + v.value + v.done); });
+    ag.next().then(function(v) { resumeTestLog.push('c' + v.done); });
+)"),
+               StringRef::createFromASCII("test.js"), false);
+    // evalScript drains pending jobs
+    s = evalScript(g_context.get(), StringRef::createFromASCII("resumeTestLog.sort().join()"), StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "4,4,a1,async,b2true,ctrue");
+}
+
+TEST(GlobalObject, LazyBuiltinMethod)
+{
+    // lazy builtin methods should be indistinguishable from eagerly created ones
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    (function() {
+        var r = [];
+        r.push([].map === Array.prototype.map, [].map === [].map);
+        var d1 = Object.getOwnPropertyDescriptor(String.prototype, 'padStart');
+        r.push(typeof d1.value, d1.writable, d1.enumerable, d1.configurable);
+        var d2 = Object.getOwnPropertyDescriptor(String.prototype, 'padStart');
+        r.push(d1.value === d2.value, d2.writable, d2.enumerable, d2.configurable, 'a'.padStart(3, '-'), ''.padStart === d1.value);
+        return r.join();
+    })()
+)"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "true,true,function,true,false,true,true,true,false,true,--a,true");
+
+    // freezing the prototype converts untouched methods too (use a new context not to affect other tests)
+    PersistentRefHolder<ContextRef> context = createEscargotContext(g_instance.get());
+    s = evalScript(context.get(), StringRef::createFromASCII(R"(
+    (function() {
+        'use strict';
+        var r = [];
+        Object.freeze(Array.prototype);
+        r.push(Object.isFrozen(Array.prototype));
+        var d = Object.getOwnPropertyDescriptor(Array.prototype, 'reduceRight');
+        r.push(typeof d.value, d.writable, d.enumerable, d.configurable);
+        r.push([1, 2, 3].reduceRight(function(a, b) { return a + '' + b; }), [].reduceRight === d.value);
+        try { Array.prototype.reduceRight = 1; } catch (e) { r.push(e instanceof TypeError); }
+        try { delete Array.prototype.lastIndexOf; } catch (e) { r.push(e instanceof TypeError, typeof Array.prototype.lastIndexOf); }
+        return r.join();
+    })()
+)"),
+                   StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "true,function,false,false,false,321,true,true,true,function");
+}
+
+TEST(EvalScript, AwaitResumeAllocation)
+{
+    // await on top of function body resumes without allocating resume code and environments
+    // compare with the same awaits inside of try statement which always use resume code
+    std::string awaits;
+    for (int i = 0; i < 1000; i++) {
+        awaits += "await 0;";
+    }
+    std::string directSrc = "(async function() { " + awaits + " })(); 'done'";
+    std::string resumeCodeSrc = "(async function() { try { " + awaits + " } finally { } })(); 'done'";
+
+    size_t before = Memory::totalSize();
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(directSrc.data(), directSrc.length()), StringRef::createFromASCII("test.js"), false);
+    size_t directBytes = Memory::totalSize() - before;
+    EXPECT_EQ(s, "done");
+
+    before = Memory::totalSize();
+    s = evalScript(g_context.get(), StringRef::createFromASCII(resumeCodeSrc.data(), resumeCodeSrc.length()), StringRef::createFromASCII("test.js"), false);
+    size_t resumeCodeBytes = Memory::totalSize() - before;
+    EXPECT_EQ(s, "done");
+
+    EXPECT_LT(directBytes, resumeCodeBytes);
+}
+
 TEST(DisabledStackOverflow, Basic)
 {
     Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {